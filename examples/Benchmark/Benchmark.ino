@@ -0,0 +1,322 @@
+/*! @file Benchmark.ino
+
+@section Benchmark_intro_section Description
+
+Example program for using the DS3231M library which allows access to the DS3231M real-time-clock
+chip. The library as well as the most current version of this program is available at GitHub using
+the address https://github.com/Zanduino/DS3231M and a more detailed description of this program
+(and the library) can be found at https://github.com/Zanduino/DS3231M/wiki \n\n
+
+This program measures the time taken by the DateTime and TimeSpan class methods and counts the I2C
+transactions made by each public DS3231M_Class method. All results are written to the serial port
+as comma-separated lines so that the output of different library versions can be compared with a
+simple "diff". Lines starting with "bench" have the format
+"bench,name,iterations,total_us,ns_each,cycles_each" where the time of an empty call has been
+subtracted and the cycles are computed from F_CPU, and lines starting with "i2c" have the format
+"i2c,method,reads,writes". Lines starting with "size" have the format "size,type,bytes" and show
+the RAM needed for each date/time representation as well as the PROGMEM size of a time zone rule
+and the RAM size of a DS3231M_TimeZone. The "bcd2int()" and "int2bcd()" conversions are private and
+are measured as part of the "now()" and "adjust()" calls.
+
+The DateTime toString() and parse() methods are compared with sprintf() and sscanf(). To compare
+the flash size, compile the program with BENCHMARK_STDIO set to 1 and to 0, the difference in the
+program size reported by the compiler is the code pulled in by sprintf() and sscanf().
+
+By default only the methods that read from the DS3231M have their I2C transactions counted. The
+methods that write to it, such as adjust(), setAlarm() and setAgingOffset(), overwrite the time, the
+alarms, the aging offset and the pin settings of the device. Their counts are only made when the
+program is compiled with BENCHMARK_WRITES set to 1, and a "warning" line is printed first.
+
+@section Benchmarklicense __**GNU General Public License v3.0**__
+
+This program is free software: you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version. This program is distributed in the hope that it will
+be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details. You should have
+received a copy of the GNU General Public License along with this program.  If not, see
+<http://www.gnu.org/licenses/>.
+
+@section Benchmarkauthor Author
+
+ Written by Arnd <Arnd@Zanduino.Com> at https://www.github.com/SV-Zanshin
+
+@section Benchmarkversions Changelog
+
+Version | Date       | Developer  | Comments
+------- | ---------- | ---------- | ---------------------------------------------
+1.0.8   | 2026-10-17 | SV-Zanshin | Write transaction counts only with BENCHMARK_WRITES set
+1.0.7   | 2026-10-17 | SV-Zanshin | Added DS3231M_SharedTime reader benchmarks
+1.0.6   | 2026-10-17 | SV-Zanshin | Added serviceAlarms() transaction count
+1.0.5   | 2026-10-17 | SV-Zanshin | Added small span and in-place DateTime arithmetic benchmarks
+1.0.4   | 2026-10-17 | SV-Zanshin | Added time zone lookup benchmarks and zone sizes
+1.0.3   | 2026-10-17 | SV-Zanshin | Added toString()/parse() benchmarks and cycles per call
+1.0.2   | 2026-10-17 | SV-Zanshin | Added PackedDateTime benchmarks and size report
+1.0.1   | 2026-10-17 | SV-Zanshin | Added batch conversion benchmarks
+1.0.0   | 2026-10-17 | SV-Zanshin | Initial coding
+*/
+#include <DS3231M.h>  // Include the DS3231M RTC library
+#ifndef BENCHMARK_STDIO
+  /*! @brief Set to 0 to leave out the sprintf() and sscanf() benchmarks to compare flash size */
+  #define BENCHMARK_STDIO 1
+#endif
+#ifndef BENCHMARK_WRITES
+  /*! @brief Set to 1 to also count the methods that write to the device and change its settings */
+  #define BENCHMARK_WRITES 0
+#endif
+/***************************************************************************************************
+** Declare all program constants                                                                  **
+***************************************************************************************************/
+const uint32_t SERIAL_SPEED{115200};        ///< Set the baud rate for Serial I/O
+const uint16_t BENCHMARK_ITERATIONS{1000};  ///< Number of calls timed for each benchmark
+const uint16_t CPU_MHZ{F_CPU / 1000000UL};  ///< Processor clock in MHz for the cycle counts
+
+/***************************************************************************************************
+** Declare global variables and instantiate classes                                               **
+***************************************************************************************************/
+DS3231M_Class      DS3231M;                            ///< Create an instance of the DS3231M class
+volatile uint32_t  sink;                               ///< Results go here to avoid optimizing out
+DateTime           testTime(2024, 2, 29, 23, 59, 58);  ///< Date/Time used in the benchmarks
+uint32_t           testUnix = 1709251198;              ///< UNIX time used in the benchmarks
+TimeSpan           testSpan(1, 2, 3, 4);               ///< TimeSpan used in the benchmarks
+TimeSpan           testStep(0, 0, 1, 30);              ///< Small TimeSpan used in the benchmarks
+DateTime           stepTime(testTime);                 ///< Date/Time stepped in place
+PackedDateTime     testPacked(testTime);               ///< Packed Date/Time used in the benchmarks
+uint32_t           emptyMicros = 0;                    ///< Time taken by an empty benchmark
+uint32_t           batchTimes[16];                     ///< UNIX times for the batch benchmark
+uint16_t           batchYears[16];                     ///< Years for the batch benchmark
+uint8_t            batchMonths[16];                    ///< Months for the batch benchmark
+uint8_t            batchDays[16];                      ///< Days for the batch benchmark
+uint8_t            batchHours[16];                     ///< Hours for the batch benchmark
+uint8_t            batchMinutes[16];                   ///< Minutes for the batch benchmark
+uint8_t            batchSeconds[16];                   ///< Seconds for the batch benchmark
+char               textBuffer[32];                     ///< Buffer for the text benchmarks
+const char*        testText = "2024-02-29T23:59:58";   ///< Text used in the parse benchmarks
+DS3231M_TimeZone   testZone(&DS3231M_ZONE_BERLIN);     ///< Time zone used in the benchmarks
+DS3231M_SharedTime sharedTime(DS3231M);                ///< Published time used in the benchmarks
+
+uint32_t timeBenchmark(void (*function)()) {
+  /*!
+   @brief    Call a function a number of times and return the time taken
+   @param[in] function Function to call
+   @return   Microseconds taken for all the calls
+  */
+  uint32_t startMicros = micros();
+  for (uint16_t i = 0; i < BENCHMARK_ITERATIONS; ++i) {
+    function();
+  }  // for-next each iteration
+  return micros() - startMicros;
+}  // of method timeBenchmark()
+
+void runBenchmark(const __FlashStringHelper* name, void (*function)()) {
+  /*!
+   @brief    Time a function and print the result as a comma-separated line
+   @param[in] name Name of the benchmark
+   @param[in] function Function to call
+  */
+  uint32_t totalMicros = timeBenchmark(function);
+  totalMicros          = totalMicros > emptyMicros ? totalMicros - emptyMicros : 0;
+  Serial.print(F("bench,"));
+  Serial.print(name);
+  Serial.print(',');
+  Serial.print(BENCHMARK_ITERATIONS);
+  Serial.print(',');
+  Serial.print(totalMicros);
+  Serial.print(',');
+  Serial.print(totalMicros * 1000 / BENCHMARK_ITERATIONS);
+  Serial.print(',');
+  Serial.println(totalMicros * CPU_MHZ / BENCHMARK_ITERATIONS);
+}  // of method runBenchmark()
+
+void countTransactions(const __FlashStringHelper* name, void (*function)()) {
+  /*!
+   @brief    Call a library method once and print the number of I2C transactions it made
+   @param[in] name Name of the method
+   @param[in] function Function to call
+  */
+  DS3231M.resetCounters();
+  function();
+  Serial.print(F("i2c,"));
+  Serial.print(name);
+  Serial.print(',');
+  Serial.print(DS3231M.readCount());
+  Serial.print(',');
+  Serial.println(DS3231M.writeCount());
+}  // of method countTransactions()
+
+void printSize(const __FlashStringHelper* name, const size_t bytes) {
+  /*!
+   @brief    Print the size of a type as a comma-separated line
+   @param[in] name Name of the type
+   @param[in] bytes sizeof() the type
+  */
+  Serial.print(F("size,"));
+  Serial.print(name);
+  Serial.print(',');
+  Serial.println(bytes);
+}  // of method printSize()
+
+void countAllTransactions() {
+  /*!
+   @brief    Count the I2C transactions of each public DS3231M_Class method
+   @details  The methods that write to the device are only counted when BENCHMARK_WRITES is set
+  */
+  countTransactions(F("now"), []() { sink = DS3231M.now().second(); });
+  countTransactions(F("nowPacked"), []() { sink = DS3231M.nowPacked().unixtime(); });
+  countTransactions(F("snapshot"), []() {
+    DS3231M_Snapshot snap;
+    sink = DS3231M.snapshot(snap);
+  });
+  countTransactions(F("temperature"), []() { sink = DS3231M.temperature(); });
+  countTransactions(F("isStopped"), []() { sink = DS3231M.isStopped(); });
+  countTransactions(F("isAlarm"), []() { sink = DS3231M.isAlarm(); });
+  countTransactions(F("SharedTime.refresh"), []() { sink = sharedTime.refresh(); });
+  countTransactions(F("SharedTime.now"), []() { sink = sharedTime.now().second(); });
+  countTransactions(F("getAgingOffset"), []() { sink = DS3231M.getAgingOffset(); });
+  countTransactions(F("weekdayRead"), []() { sink = DS3231M.weekdayRead(); });
+#if BENCHMARK_WRITES
+  countTransactions(F("adjust"), []() { DS3231M.adjust(testTime); });
+  countTransactions(F("setAlarm1"), []() { DS3231M.setAlarm(secondsMatch, testTime); });
+  countTransactions(F("setAlarm2"), []() { DS3231M.setAlarm(minutesHoursDayMatch, testTime); });
+  countTransactions(F("clearAlarm"), []() { DS3231M.clearAlarm(); });
+  countTransactions(F("serviceAlarms"), []() { sink = DS3231M.serviceAlarms(); });
+  countTransactions(F("kHz32"), []() { DS3231M.kHz32(false); });
+  countTransactions(F("setAgingOffset"), []() { sink = DS3231M.setAgingOffset(0); });
+  countTransactions(F("weekdayWrite"), []() { sink = DS3231M.weekdayWrite(4); });
+  countTransactions(F("pinAlarm"), []() { DS3231M.pinAlarm(); });
+  countTransactions(F("pinSquareWave"), []() { DS3231M.pinSquareWave(); });
+#endif
+}  // of method countAllTransactions()
+
+void setup() {
+  /*!
+   @brief    Arduino method called once at startup to initialize the system
+   @details  This is an Arduino IDE method which is called first upon boot or restart. It is only
+             called one time and then control goes to the main "loop()" method, from which control
+             never returns
+   @return   void
+  */
+  Serial.begin(SERIAL_SPEED);
+#ifdef __AVR_ATmega32U4__  // If this is a 32U4 processor, then wait for serial to initialize
+  delay(3000);
+#endif
+  Serial.print(F("\nStarting Benchmark program\n"));
+  Serial.print(F("- Compiled with c++ version "));
+  Serial.print(F(__VERSION__));
+  Serial.print(F("\n- On "));
+  Serial.print(F(__DATE__));
+  Serial.print(F(" at "));
+  Serial.print(F(__TIME__));
+  Serial.print(F("\n"));
+  emptyMicros = timeBenchmark([]() {});  // Overhead of the loop and the function call
+  runBenchmark(F("DateTime(uint32_t)"), []() { sink = DateTime(testUnix).day(); });
+  runBenchmark(F("DateTime(y,m,d,h,m,s)"),
+               []() { sink = DateTime(2024, 2, 29, 23, 59, 58).day(); });
+  runBenchmark(F("DateTime(char*,char*)"),
+               []() { sink = DateTime("Feb 29 2024", "23:59:58").day(); });
+  runBenchmark(F("DateTime(F(),F())"),
+               []() { sink = DateTime(F("Feb 29 2024"), F("23:59:58")).day(); });
+  runBenchmark(F("unixtime"), []() { sink = testTime.unixtime(); });
+  runBenchmark(F("secondstime"), []() { sink = testTime.secondstime(); });
+  runBenchmark(F("dayOfTheWeek"), []() { sink = testTime.dayOfTheWeek(); });
+  runBenchmark(F("DateTime+TimeSpan"), []() { sink = (testTime + testSpan).day(); });
+  runBenchmark(F("DateTime-TimeSpan"), []() { sink = (testTime - testSpan).day(); });
+  runBenchmark(F("DateTime+small TimeSpan"), []() { sink = (testTime + testStep).day(); });
+  runBenchmark(F("DateTime-small TimeSpan"), []() { sink = (testTime - testStep).day(); });
+  runBenchmark(F("DateTime+=small TimeSpan"), []() {
+    stepTime += testStep;
+    stepTime -= testStep;
+    sink = stepTime.day();
+  });
+  runBenchmark(F("DateTime-DateTime"), []() { sink = (testTime - testTime).totalseconds(); });
+  runBenchmark(F("TimeSpan+TimeSpan"), []() { sink = (testSpan + testSpan).totalseconds(); });
+  runBenchmark(F("TimeSpan-TimeSpan"), []() { sink = (testSpan - testSpan).totalseconds(); });
+  for (uint8_t i = 0; i < 16; ++i) {
+    batchTimes[i] = testUnix + i * 86399UL;  // Fill the batch with different days and times
+  }                                          // for-next each batch entry
+  runBenchmark(F("convertUnixtime x16"), []() {
+    DateTime::convertUnixtime(batchTimes, 16, batchYears, batchMonths, batchDays, batchHours,
+                              batchMinutes, batchSeconds);
+  });
+  runBenchmark(F("convertFields x16"), []() {
+    DateTime::convertFields(batchYears, batchMonths, batchDays, batchHours, batchMinutes,
+                            batchSeconds, 16, batchTimes);
+  });
+  runBenchmark(F("DateTime(uint32_t) x16"), []() {
+    for (uint8_t i = 0; i < 16; ++i) {
+      sink = DateTime(batchTimes[i]).day();
+    }  // for-next each batch entry
+  });
+  runBenchmark(F("TimeSpan fields"), []() {
+    sink = testSpan.days() + testSpan.hours() + testSpan.minutes() + testSpan.seconds();
+  });
+  runBenchmark(F("PackedDateTime(DateTime)"), []() { sink = PackedDateTime(testTime).unixtime(); });
+  runBenchmark(F("PackedDateTime.dateTime"), []() { sink = testPacked.dateTime().day(); });
+  runBenchmark(F("PackedDateTime.hour"), []() { sink = testPacked.hour(); });
+  runBenchmark(F("PackedDateTime.day"), []() { sink = testPacked.day(); });
+  runBenchmark(F("PackedDateTime-PackedDateTime"),
+               []() { sink = (testPacked - testPacked).totalseconds(); });
+  runBenchmark(F("PackedDateTime+TimeSpan"), []() { sink = (testPacked + testSpan).unixtime(); });
+  runBenchmark(F("PackedDateTime<PackedDateTime"), []() { sink = testPacked < testPacked; });
+  runBenchmark(F("toString"), []() { sink = testTime.toString(textBuffer, sizeof(textBuffer)); });
+  runBenchmark(F("parse"), []() {
+    DateTime result;
+    sink = DateTime::parse(testText, result);
+    sink = result.day();
+  });
+#if BENCHMARK_STDIO
+  runBenchmark(F("sprintf"), []() {
+    sink = sprintf(textBuffer, "%04d-%02d-%02dT%02d:%02d:%02d", testTime.year(), testTime.month(),
+                   testTime.day(), testTime.hour(), testTime.minute(), testTime.second());
+  });
+  runBenchmark(F("sscanf"), []() {
+    unsigned int year, month, day, hour, minute, second;
+    sink = sscanf(testText, "%u-%u-%uT%u:%u:%u", &year, &month, &day, &hour, &minute, &second);
+    sink = DateTime(year, month, day, hour, minute, second).day();
+  });
+#endif
+  runBenchmark(F("TimeZone.offset"), []() { sink = testZone.offset(testUnix); });
+  runBenchmark(F("TimeZone.offset new year"), []() {
+    testUnix += 366 * SECONDS_PER_DAY;  // Every call needs the transitions of another year
+    sink = testZone.offset(testUnix);
+    testUnix -= 366 * SECONDS_PER_DAY;
+  });
+  runBenchmark(F("TimeZone.toLocal(uint32_t)"), []() { sink = testZone.toLocal(testUnix); });
+  runBenchmark(F("TimeZone.toUtc(uint32_t)"), []() { sink = testZone.toUtc(testUnix); });
+  runBenchmark(F("TimeZone.toLocal(DateTime)"), []() { sink = testZone.toLocal(testTime).day(); });
+  printSize(F("DateTime"), sizeof(DateTime));
+  printSize(F("PackedDateTime"), sizeof(PackedDateTime));
+  printSize(F("DateTime[100]"), sizeof(DateTime[100]));
+  printSize(F("PackedDateTime[100]"), sizeof(PackedDateTime[100]));
+  printSize(F("DS3231M_Zone"), sizeof(DS3231M_Zone));
+  printSize(F("DS3231M_TimeZone"), sizeof(DS3231M_TimeZone));
+  if (DS3231M.begin())  // I2C benchmarks only when a device is present
+  {
+    runBenchmark(F("now"), []() { sink = DS3231M.now().second(); });
+    runBenchmark(F("nowPacked"), []() { sink = DS3231M.nowPacked().unixtime(); });
+    runBenchmark(F("temperature"), []() { sink = DS3231M.temperature(); });
+    sharedTime.refresh();  // Publish once, the readers below do no I2C traffic
+    runBenchmark(F("SharedTime.now"), []() { sink = sharedTime.now().second(); });
+    runBenchmark(F("SharedTime.temperature"), []() { sink = sharedTime.temperature(); });
+#if BENCHMARK_WRITES
+    Serial.println(F("warning,write counts overwrite the time, alarms and settings of the RTC"));
+#endif
+    countAllTransactions();
+    DS3231M.refresh();  // Repeat the counts with the register shadow copy active
+    Serial.println(F("shadow,on"));
+    countAllTransactions();
+    DS3231M.invalidate();
+  } else {
+    Serial.println(F("Unable to find DS3231M, I2C benchmarks skipped"));
+  }  // of if-then-else device found
+  Serial.println(F("done"));
+}  // of method setup()
+
+void loop() {
+  /*!
+   @brief    Arduino method for the main program loop
+   @details  This is the main program for the Arduino IDE, it is an infinite loop and keeps on
+             repeating. All the benchmarks are run once in setup()
+   @return   void
+  */
+}  // of method loop()
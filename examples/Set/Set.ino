@@ -29,6 +29,7 @@ received a copy of the GNU General Public License along with this program.  If n
 
 Version | Date       | Developer  | Comments
 ------- | ---------- | ---------- | ---------------------------------------------
+1.0.5   | 2026-10-17 | SV-Zanshin | Use DateTime toString()/parse() instead of sprintf()/sscanf()
 1.0.4   | 2021-12-27 | simmunity  | Corrected typographical errors in comments
 1.0.3   | 2019-10-16 | simmunity  | Corrected "inputBuffer" issue
 1.0.2   | 2019-02-02 | SV-Zanshin | Issue #7 - convert documentation to Doxygen
@@ -40,7 +41,7 @@ Version | Date       | Developer  | Comments
 ** Declare all program constants                                                                  **
 ***************************************************************************************************/
 const uint32_t SERIAL_SPEED{115200};     ///< Set the baud rate for Serial I/O
-const uint8_t  SPRINTF_BUFFER_SIZE{32};  ///< Buffer size for sprintf()
+const uint8_t  TEXT_BUFFER_SIZE{32};     ///< Buffer size for serial input
 const uint8_t  LED_PIN{13};              ///< Built-in Arduino green LED pin
 
 /***************************************************************************************************
@@ -94,13 +95,13 @@ void readCommand() {
              acted upon
    @return   void
   */
-  static char    text_buffer[SPRINTF_BUFFER_SIZE];  ///< Buffer for sprintf()/sscanf()
-  static uint8_t text_index = 0;                    ///< Variable for buffer position
-  while (Serial.available())                        // Loop while there is incoming serial data
+  static char    text_buffer[TEXT_BUFFER_SIZE];  ///< Buffer for the serial input
+  static uint8_t text_index = 0;                 ///< Variable for buffer position
+  while (Serial.available())                     // Loop while there is incoming serial data
   {
     text_buffer[text_index] = Serial.read();  // Get the next byte of data
     // keep on reading until a newline shows up or the buffer is full
-    if (text_buffer[text_index] != '\n' && text_index < SPRINTF_BUFFER_SIZE) {
+    if (text_buffer[text_index] != '\n' && text_index < TEXT_BUFFER_SIZE - 1) {
       text_index++;
     } else {
       text_buffer[text_index] = 0;              // Add the termination character
@@ -120,29 +121,26 @@ void readCommand() {
       *********************************************************************************************/
       enum commands { SetDate, Unknown_Command };  // enumerate all commands
       commands command;                            // declare enumerated type
-      char     workBuffer[SPRINTF_BUFFER_SIZE];    // Buffer to hold string compare
-      sscanf(text_buffer, "%s %*s", workBuffer);   // Parse the string for first word
-      if (!strcmp(workBuffer, "SETDATE")) {
-        command = SetDate;  // Set command number when found
+      if (!strncmp(text_buffer, "SETDATE ", 8)) {  // Check the first word
+        command = SetDate;                         // Set command number when found
       } else {
         command = Unknown_Command;  // Otherwise set to not found
       }                             // if-then-else a known command
-      unsigned int tokens, year, month, day, hour, minute,
-          second;  // Variables to hold parsed date/time
+      DateTime     newTime;         // Holds the parsed date/time
+      parseResults result;          // Result of parsing the date/time
       switch (command) {
         /*********************************
         ** Set the device time and date **
         *********************************/
         case SetDate:
-          // Use sscanf() to parse the date/time into component variables
-          tokens = sscanf(text_buffer, "%*s %u-%u-%u %u:%u:%u;", &year, &month, &day, &hour,
-                          &minute, &second);
-          if (tokens != 6)  // Check to see if it was parsed correctly
-          {
+          // Parse the date/time following the command, a "T" separator is also accepted
+          result = DateTime::parse(text_buffer + 8, newTime, isoSpaceFormat);
+          if (result == parseSyntax) {
             Serial.print(F("Unable to parse date/time\n"));
+          } else if (result == parseRange) {
+            Serial.print(F("Date/time value out of range\n"));
           } else {
-            DS3231M.adjust(
-                DateTime(year, month, day, hour, minute, second));  // Adjust the RTC date/time
+            DS3231M.adjust(newTime);  // Adjust the RTC date/time
             Serial.print(F("Date has been set."));
           }  // of if-then-else the date could be parsed
           break;
@@ -170,10 +168,9 @@ void loop() {
   DateTime       now = DS3231M.now();  // get the current time from device
   if (secs != now.second())            // Output if seconds have changed
   {
-    // Use sprintf() to pretty print the date/time with leading zeros
-    char output_buffer[SPRINTF_BUFFER_SIZE];  ///< Temporary buffer for sprintf()
-    sprintf(output_buffer, "%04d-%02d-%02d %02d:%02d:%02d", now.year(), now.month(), now.day(),
-            now.hour(), now.minute(), now.second());
+    // Use toString() to pretty print the date/time with leading zeros
+    char output_buffer[DS3231M_DATE_TIME_SIZE];  ///< Temporary buffer for toString()
+    now.toString(output_buffer, DS3231M_DATE_TIME_SIZE, isoSpaceFormat);
     Serial.println(output_buffer);
     secs = now.second();  // Set the counter variable
   }                       // of if the seconds have changed
@@ -29,6 +29,7 @@ received a copy of the GNU General Public License along with this program.  If n
 
 Version | Date       | Developer  | Comments
 ------- | ---------- | ---------- | ---------------------------------------------------
+1.0.3   | 2026-10-17 | SV-Zanshin | Use serviceAlarms() to check and clear the alarm
 1.0.2   | 2020-12-12 | SV-Zanshin | reformatted to clang-format
 1.0.1   | 2019-02-02 | SV-Zanshin | Issue #7 - convert documentation to Doxygen
 1.0.0   | 2017-08-19 | SV-Zanshin | Initial coding
@@ -109,10 +110,9 @@ void loop() {
     Serial.println(inputBuffer);  // Display the current date/time
     secs = now.second();          // Set the counter variable
   }                               // of if the seconds have changed
-  if (DS3231M.isAlarm())          // If the alarm bit is set
+  if (DS3231M.serviceAlarms() & DS3231M_ALARM1)  // If alarm 1 has triggered, also clears it
   {
     Serial.println("Alarm has gone off.");
-    DS3231M.clearAlarm();
     // Alarm in 12 seconds. This will also reset the alarm state
     DS3231M.setAlarm(secondsMinutesHoursDateMatch, now + TimeSpan(0, 0, 0, 12));
   }  // of if-then an alarm has triggered
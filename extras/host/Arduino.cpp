@@ -0,0 +1,171 @@
+/*!
+ @file Arduino.cpp
+ @section Arduino_host_cpp_intro_section Description
+ Simulated clock and serial port of the host build, see "Arduino.h"
+*/
+#include "Arduino.h"
+
+#include <atomic>
+
+static std::atomic<uint64_t> clockMicros(0);  ///< Simulated time, read by several threads
+static HostTimer*            timers[8];       ///< Registered timers
+static uint8_t               timerCount = 0;  ///< Number of registered timers
+HostSerial                   Serial;          ///< Serial port replacement
+
+uint64_t hostMicros() {
+  /*!
+   @brief     returns the simulated time
+   @return    Microseconds since hostReset()
+  */
+  return clockMicros.load();
+}  // of method hostMicros()
+void hostAdvance(const uint64_t us) {
+  /*!
+   @brief     advances the simulated clock, running each timer event at its own time
+   @details   Only one thread may advance the clock, other threads may read it
+   @param[in] us Microseconds to advance
+  */
+  uint64_t target = clockMicros.load() + us;
+  for (;;) {
+    HostTimer* next     = nullptr;
+    uint64_t   nextTime = target;
+    for (uint8_t i = 0; i < timerCount; ++i) {
+      uint64_t t = timers[i]->nextEvent();
+      if (t <= nextTime && (next == nullptr || t < nextTime)) {
+        next     = timers[i];
+        nextTime = t;
+      }  // if-then earliest event so far
+    }    // for-next each timer
+    if (next == nullptr) {
+      break;
+    }  // if-then no more events before the target
+    if (nextTime > clockMicros.load()) {
+      clockMicros.store(nextTime);
+    }  // if-then event is in the future
+    next->event();
+  }  // of for-ever each event
+  clockMicros.store(target);
+}  // of method hostAdvance()
+void hostAddTimer(HostTimer* timer) {
+  /*!
+   @brief     registers a timer whose events run when the clock is advanced
+   @param[in] timer Timer object
+  */
+  if (timerCount < sizeof(timers) / sizeof(timers[0])) {
+    timers[timerCount++] = timer;
+  }  // if-then space left
+}  // of method hostAddTimer()
+void hostRemoveTimer(HostTimer* timer) {
+  /*!
+   @brief     unregisters a timer
+   @param[in] timer Timer object
+  */
+  for (uint8_t i = 0; i < timerCount; ++i) {
+    if (timers[i] == timer) {
+      timers[i] = timers[--timerCount];
+      return;
+    }  // if-then found
+  }    // for-next each timer
+}  // of method hostRemoveTimer()
+void hostReset() {
+  /*!
+   @brief     sets the clock back to 0 and unregisters all timers
+  */
+  clockMicros.store(0);
+  timerCount = 0;
+}  // of method hostReset()
+uint32_t millis() { return hostMicros() / 1000; }             ///< Simulated milliseconds
+uint32_t micros() { return hostMicros(); }                    ///< Simulated microseconds
+void     delay(const uint32_t ms) { hostAdvance(ms * 1000ULL); }   ///< Advance the clock
+void     delayMicroseconds(const uint32_t us) { hostAdvance(us); }  ///< Advance the clock
+void     noInterrupts() {}                                    ///< No interrupts on the host
+void     interrupts() {}                                      ///< No interrupts on the host
+void     pinMode(const uint8_t, const uint8_t) {}             ///< Ignored
+void     digitalWrite(const uint8_t, const uint8_t) {}        ///< Ignored
+
+size_t HostSerial::write(const char* text) {
+  /*!
+   @brief     writes text to stdout
+   @param[in] text Zero-terminated text
+   @return    Number of characters
+  */
+  size_t length = strlen(text);
+  if (!quiet) {
+    fwrite(text, 1, length, stdout);
+  }  // if-then output wanted
+  return length;
+}  // of method write()
+size_t HostSerial::write(const uint8_t c) {
+  /*!
+   @brief     writes a character to stdout
+   @param[in] c Character
+   @return    1
+  */
+  char text[2] = {(char)c, 0};
+  return write(text);
+}  // of method write()
+size_t HostSerial::print(const __FlashStringHelper* text) {
+  /*!
+   @brief     prints a flash string
+   @param[in] text Flash string, an ordinary string on the host
+   @return    Number of characters
+  */
+  return write(reinterpret_cast<const char*>(text));
+}  // of method print()
+size_t HostSerial::print(const long value, const int base) {
+  /*!
+   @brief     prints a signed number
+   @param[in] value Number
+   @param[in] base Base 10 or 16
+   @return    Number of characters
+  */
+  if (base == 10) {
+    char text[24];
+    snprintf(text, sizeof(text), "%ld", value);
+    return write(text);
+  }  // if-then decimal
+  return print((unsigned long)value, base);
+}  // of method print()
+size_t HostSerial::print(const unsigned long value, const int base) {
+  /*!
+   @brief     prints an unsigned number
+   @param[in] value Number
+   @param[in] base Base 10 or 16
+   @return    Number of characters
+  */
+  char text[24];
+  snprintf(text, sizeof(text), base == 16 ? "%lX" : "%lu", value);
+  return write(text);
+}  // of method print()
+size_t HostSerial::print(const double value, const int digits) {
+  /*!
+   @brief     prints a floating point number
+   @param[in] value Number
+   @param[in] digits Number of decimals
+   @return    Number of characters
+  */
+  char text[32];
+  snprintf(text, sizeof(text), "%.*f", digits, value);
+  return write(text);
+}  // of method print()
+int HostSerial::available() {
+  /*!
+   @brief     returns the number of queued input characters
+   @return    Number of characters
+  */
+  return strlen(_input);
+}  // of method available()
+int HostSerial::read() {
+  /*!
+   @brief     returns the next queued input character
+   @return    Character, -1 when there is no input
+  */
+  return *_input ? *_input++ : -1;
+}  // of method read()
+void HostSerial::hostInput(const char* text) {
+  /*!
+   @brief     queues input text, which must stay valid until it has been read
+   @param[in] text Zero-terminated text
+  */
+  _input = text;
+}  // of method hostInput()
@@ -0,0 +1,105 @@
+/*! @file Arduino.h
+
+@section Arduino_host_intro_section Description
+
+Minimal replacement of the Arduino core for compiling the DS3231M library and its examples natively
+on a Linux or macOS host. Only what the library and the examples use is provided. Time does not
+pass on its own: millis() and micros() return a simulated clock which is moved forward by delay(),
+delayMicroseconds(), the simulated I2C transactions and hostAdvance(). Objects registered with
+hostAddTimer(), such as the DS3231M simulator, are given control at the exact simulated time of
+each of their events, e.g. to count the seconds or to raise the INT/SQW edge interrupt.
+
+See the library header "DS3231M.h" for the license and the author details.
+*/
+#ifndef Arduino_host_h
+  /*! @brief Guard code definition to prevent multiple definitions */
+  #define Arduino_host_h
+  #include <ctype.h>
+  #include <stddef.h>
+  #include <stdint.h>
+  #include <stdio.h>
+  #include <stdlib.h>
+  #include <string.h>
+  #ifndef F_CPU
+    /*! @brief Processor clock assumed for the cycle counts of the benchmark example */
+    #define F_CPU 16000000UL
+  #endif
+  /*! @brief Flash storage is ordinary memory on the host */
+  #define PROGMEM
+  /*! @brief Read a byte from flash */
+  #define pgm_read_byte(p) (*(const uint8_t*)(p))
+  /*! @brief Read a 16 bit word from flash */
+  #define pgm_read_word(p) (*(const uint16_t*)(p))
+  /*! @brief Read a 32 bit word from flash */
+  #define pgm_read_dword(p) (*(const uint32_t*)(p))
+  /*! @brief Copy from flash to memory */
+  #define memcpy_P memcpy
+  /*! @brief Flash string marker, strings stay in memory on the host */
+  #define F(s) (reinterpret_cast<const __FlashStringHelper*>(s))
+  #define INPUT  0x0  ///< pinMode() input
+  #define OUTPUT 0x1  ///< pinMode() output
+  #define LOW    0x0  ///< digitalWrite() low
+  #define HIGH   0x1  ///< digitalWrite() high
+
+class __FlashStringHelper;  ///< Flash string type of F()
+
+uint32_t millis();                                      // Simulated milliseconds
+uint32_t micros();                                      // Simulated microseconds
+void     delay(const uint32_t ms);                      // Advance the simulated clock
+void     delayMicroseconds(const uint32_t us);          // Advance the simulated clock
+void     noInterrupts();                                // No interrupts on the host
+void     interrupts();                                  // No interrupts on the host
+void     pinMode(const uint8_t pin, const uint8_t mode);  // Ignored
+void     digitalWrite(const uint8_t pin, const uint8_t value);  // Ignored
+
+/*!
+ @brief    Object that needs control at simulated points in time, see hostAddTimer()
+*/
+class HostTimer {
+ public:
+  virtual uint64_t nextEvent() = 0;  ///< Simulated microseconds of the next event
+  virtual void     event()     = 0;  ///< Called when the simulated clock reaches nextEvent()
+};                                   // of HostTimer class definition
+uint64_t hostMicros();                       // Simulated microseconds, 64 bits
+void     hostAdvance(const uint64_t us);     // Advance the clock, running the timer events
+void     hostAddTimer(HostTimer* timer);     // Register a timer
+void     hostRemoveTimer(HostTimer* timer);  // Unregister a timer
+void     hostReset();                        // Clock to 0 and no timers
+
+/*!
+ @brief    Serial port replacement, output goes to stdout and input comes from hostInput()
+*/
+class HostSerial {
+ public:
+  void   begin(const uint32_t) {}                             ///< Nothing to start
+  size_t write(const char* text);                             // Write text
+  size_t write(const uint8_t c);                              // Write a character
+  size_t print(const char* text) { return write(text); }      ///< Print text
+  size_t print(const __FlashStringHelper* text);              // Print a flash string
+  size_t print(const char c) { return write((uint8_t)c); }    ///< Print a character
+  size_t print(const long value, const int base = 10);        // Print a signed number
+  size_t print(const unsigned long value, const int base = 10);  // Print an unsigned number
+  size_t print(const int value, const int base = 10) { return print((long)value, base); }
+  size_t print(const unsigned int value, const int base = 10) {
+    return print((unsigned long)value, base);
+  }                                                      ///< Print an unsigned number
+  size_t print(const double value, const int digits = 2);  // Print a floating point number
+  template <class T>
+  size_t println(const T& value) {
+    return print(value) + println();
+  }  ///< Print a value and a line break
+  template <class T>
+  size_t println(const T& value, const int format) {
+    return print(value, format) + println();
+  }                                    ///< Print a formatted value and a line break
+  size_t println() { return write("\n"); }  ///< Print a line break
+  int    available();                       // Number of input characters waiting
+  int    read();                            // Next input character, -1 if there is none
+  void   hostInput(const char* text);       // Queue input text
+  bool   quiet = false;                     ///< Set to discard the output
+
+ private:
+  const char* _input = "";  ///< Queued input
+};                          // of HostSerial class definition
+extern HostSerial Serial;   ///< Serial port replacement
+#endif
@@ -0,0 +1,264 @@
+/*!
+ @file DS3231M_Sim.cpp
+ @section DS3231M_Sim_cpp_intro_section Description
+ Simulated DS3231M of the host build, see "DS3231M_Sim.h"
+*/
+#include "DS3231M_Sim.h"
+
+static uint8_t toBcd(const uint8_t value) { return ((value / 10) << 4) | (value % 10); }  ///< BCD
+static uint8_t fromBcd(const uint8_t value) { return (value >> 4) * 10 + (value & 0x0F); }  ///< BCD
+
+DS3231M_Sim::DS3231M_Sim(const uint8_t address) : _address(address) {
+  /*!
+   @brief     Class constructor, the registers have their power-up values
+   @param[in] address I2C address
+  */
+  memset(reg, 0, sizeof(reg));
+  setTime(SECONDS_FROM_1970_TO_2000);  // 2000-01-01 00:00:00
+  reg[DS3231M_RTCWKDAY] = 1;           // The weekday register starts at 1
+  reg[DS3231M_CONTROL]  = 0x1C;        // INTCN, RS2 and RS1
+  reg[DS3231M_STATUS]   = 0x88;        // OSF and EN32kHz
+  setTemperature(_temperature);
+  hostAddTimer(this);
+}  // of constructor
+DS3231M_Sim::~DS3231M_Sim() {
+  /*!
+   @brief     Class destructor
+  */
+  hostRemoveTimer(this);
+}  // of destructor
+void DS3231M_Sim::setTime(const uint32_t unixTime) {
+  /*!
+   @brief     sets the time registers, including the weekday, and restarts the 1 second countdown
+   @param[in] unixTime UNIX time
+  */
+  encode(unixTime);
+  startSecond(hostMicros());
+}  // of method setTime()
+void DS3231M_Sim::encode(const uint32_t unixTime) {
+  /*!
+   @brief     writes a time into the BCD time registers, including the weekday
+   @details   The year 2100 is year 00 with the century bit of the month register set
+   @param[in] unixTime UNIX time
+  */
+  DateTime dt(unixTime);
+  uint8_t  century = dt.year() >= 2100 ? 0x80 : 0x00;
+  reg[DS3231M_RTCSEC]   = toBcd(dt.second());
+  reg[DS3231M_RTCMIN]   = toBcd(dt.minute());
+  reg[DS3231M_RTCHOUR]  = toBcd(dt.hour());
+  reg[DS3231M_RTCWKDAY] = dt.dayOfTheWeek();
+  reg[DS3231M_RTCDATE]  = toBcd(dt.day());
+  reg[DS3231M_RTCMTH]   = toBcd(dt.month()) | century;
+  reg[DS3231M_RTCYEAR]  = toBcd((dt.year() - 2000) % 100);
+}  // of method encode()
+void DS3231M_Sim::startSecond(const uint64_t start) {
+  /*!
+   @brief     starts counting a second, its length is adjusted by the aging offset
+   @details   Each aging offset step is 0.12ppm, the part below 1us is carried to the next seconds
+   @param[in] start Simulated time the second starts
+  */
+  int64_t adjust = (int64_t)secondMicros * (int8_t)reg[DS3231M_AGING] * 12 + _agingResidue;
+  _secondStart   = start;
+  _secondLength  = secondMicros + adjust / 100000000;
+  _agingResidue  = adjust % 100000000;
+  _edgeIndex     = 0;
+}  // of method startSecond()
+uint32_t DS3231M_Sim::time() {
+  /*!
+   @brief     decodes the time registers
+   @return    UNIX time
+  */
+  uint16_t year = 2000 + fromBcd(reg[DS3231M_RTCYEAR]) + ((reg[DS3231M_RTCMTH] & 0x80) ? 100 : 0);
+  return DateTime(year, fromBcd(reg[DS3231M_RTCMTH] & 0x1F),
+                  fromBcd(reg[DS3231M_RTCDATE]), fromBcd(reg[DS3231M_RTCHOUR] & 0x3F),
+                  fromBcd(reg[DS3231M_RTCMIN]), fromBcd(reg[DS3231M_RTCSEC]))
+      .unixtime();
+}  // of method time()
+void DS3231M_Sim::setTemperature(const int32_t temperature) {
+  /*!
+   @brief     sets the temperature registers and the result of the next conversions
+   @param[in] temperature Temperature in 1/100 degrees Celsius, stored with 0.25 degree resolution
+  */
+  _temperature    = temperature;
+  int16_t quarter = temperature >= 0 ? temperature / 25 : -((-temperature + 24) / 25);
+  reg[DS3231M_TEMPERATURE]     = (uint8_t)(quarter >> 2);
+  reg[DS3231M_TEMPERATURE + 1] = (uint8_t)((quarter & 3) << 6);
+}  // of method setTemperature()
+void DS3231M_Sim::onEdge(void (*callback)(void*), void* argument) {
+  /*!
+   @brief     sets the function called on each falling edge of the INT/SQW square wave
+   @param[in] callback Function, nullptr for none
+   @param[in] argument Passed to the function
+  */
+  _edgeCallback = callback;
+  _edgeArgument = argument;
+}  // of method onEdge()
+uint16_t DS3231M_Sim::edgeRate() {
+  /*!
+   @brief     returns the INT/SQW square wave frequency
+   @return    Frequency in Hz, 0 when INT/SQW signals the alarms
+  */
+  static const uint16_t rates[4] = {1, 1024, 4096, 8192};
+  if (reg[DS3231M_CONTROL] & DS3231M_INTCN.mask) {
+    return 0;
+  }  // if-then alarm output
+  return ds3231 ? rates[(reg[DS3231M_CONTROL] & DS3231M_RS.mask) >> DS3231M_RS.shift] : 1;
+}  // of method edgeRate()
+uint64_t DS3231M_Sim::nextEvent() {
+  /*!
+   @brief     returns the time of the next second, square wave edge or end of a conversion
+   @return    Simulated microseconds
+  */
+  uint64_t next = _secondStart + _secondLength;
+  uint16_t rate = edgeRate();
+  if (_edgeCallback && rate > 1 && _edgeIndex + 1u < rate) {
+    uint64_t edgeTime = _secondStart + (uint64_t)(_edgeIndex + 1) * _secondLength / rate;
+    next              = edgeTime < next ? edgeTime : next;
+  }  // if-then kHz square wave edge
+  if (_conversionEnd && _conversionEnd < next) {
+    next = _conversionEnd;
+  }  // if-then conversion ends first
+  return next;
+}  // of method nextEvent()
+void DS3231M_Sim::event() {
+  /*!
+   @brief     runs the event that is due at the current simulated time
+  */
+  uint64_t now = hostMicros();
+  if (_conversionEnd && now >= _conversionEnd) {
+    _conversionEnd = 0;
+    reg[DS3231M_CONTROL] &= ~DS3231M_CONV.mask;
+    reg[DS3231M_STATUS] &= ~DS3231M_BSY.mask;
+    setTemperature(_temperature);
+  } else if (now >= _secondStart + _secondLength) {
+    tick();
+  } else {
+    ++_edgeIndex;
+    edge();
+  }  // if-then-else which event
+}  // of method event()
+void DS3231M_Sim::tick() {
+  /*!
+   @brief     counts one second, the weekday at midnight, and sets the flags of matching alarms
+  */
+  uint64_t start   = _secondStart + _secondLength;
+  uint8_t  weekday = reg[DS3231M_RTCWKDAY];
+  uint8_t  date    = reg[DS3231M_RTCDATE];
+  encode(time() + 1);
+  startSecond(start);
+  reg[DS3231M_RTCWKDAY] = (reg[DS3231M_RTCDATE] != date) ? weekday % 7 + 1 : weekday;
+  const uint8_t* a1     = reg + DS3231M_ALM1SEC;
+  bool           a1Day  = (a1[3] & 0x40) ? (a1[3] & 0x0F) == reg[DS3231M_RTCWKDAY]
+                                         : (a1[3] & 0x3F) == reg[DS3231M_RTCDATE];
+  if (((a1[0] & 0x80) || (a1[0] & 0x7F) == reg[DS3231M_RTCSEC]) &&
+      ((a1[1] & 0x80) || (a1[1] & 0x7F) == reg[DS3231M_RTCMIN]) &&
+      ((a1[2] & 0x80) || (a1[2] & 0x3F) == (reg[DS3231M_RTCHOUR] & 0x3F)) &&
+      ((a1[3] & 0x80) || a1Day)) {
+    reg[DS3231M_STATUS] |= DS3231M_A1F.mask;
+  }  // if-then alarm 1 matches
+  const uint8_t* a2    = reg + DS3231M_ALM2MIN;
+  bool           a2Day = (a2[2] & 0x40) ? (a2[2] & 0x0F) == reg[DS3231M_RTCWKDAY]
+                                        : (a2[2] & 0x3F) == reg[DS3231M_RTCDATE];
+  if (reg[DS3231M_RTCSEC] == 0 && ((a2[0] & 0x80) || (a2[0] & 0x7F) == reg[DS3231M_RTCMIN]) &&
+      ((a2[1] & 0x80) || (a2[1] & 0x3F) == (reg[DS3231M_RTCHOUR] & 0x3F)) &&
+      ((a2[2] & 0x80) || a2Day)) {
+    reg[DS3231M_STATUS] |= DS3231M_A2F.mask;
+  }  // if-then alarm 2 matches
+  if (edgeRate()) {
+    edge();
+  }  // if-then square wave falls at the second
+}  // of method tick()
+void DS3231M_Sim::edge() {
+  /*!
+   @brief     reports a falling edge of the square wave
+  */
+  if (_edgeCallback) {
+    _edgeCallback(_edgeArgument);
+  }  // if-then callback set
+}  // of method edge()
+uint8_t DS3231M_Sim::write(const uint8_t address, const uint8_t reg, const uint8_t* data,
+                           const uint8_t len) {
+  /*!
+   @brief     I2C write transaction, sets the register pointer and stores the data
+   @param[in] address I2C address
+   @param[in] reg Register address
+   @param[in] data Bytes to write
+   @param[in] len Number of bytes to write
+   @return    0 on success, 2 when not acknowledged
+  */
+  hostAdvance((len + 2) * byteMicros);  // Address, register and data bytes
+  if (address != _address) {
+    return 2;
+  }  // if-then other device
+  if (len == 0 && nackAddress) {
+    --nackAddress;
+    return 2;
+  }  // if-then register pointer write fails
+  if (len != 0 && nackWrites) {
+    --nackWrites;
+    return 2;
+  }  // if-then data write fails
+  _pointer = reg % DS3231M_REGISTERS;
+  if (len) {
+    ++writes;
+  }  // if-then data written
+  for (uint8_t i = 0; i < len; ++i) {
+    uint8_t  value    = data[i];
+    uint8_t& register_ = this->reg[_pointer];
+    switch (_pointer) {
+      case DS3231M_RTCSEC:
+        register_ = value & 0x7F;
+        startSecond(hostMicros());  // Writing the seconds restarts the countdown
+        break;
+      case DS3231M_CONTROL:
+        if (_conversionEnd) {
+          value |= DS3231M_CONV.mask;  // CONV stays set until the conversion completes
+        } else if (value & DS3231M_CONV.mask) {
+          _conversionEnd = hostMicros() + convertMicros;
+          this->reg[DS3231M_STATUS] |= DS3231M_BSY.mask;
+        }  // if-then-else conversion
+        register_ = value;
+        break;
+      case DS3231M_STATUS:  // Flags can only be cleared, BSY is read only
+        register_ = (register_ & value & (DS3231M_OSF.mask | DS3231M_A2F.mask | DS3231M_A1F.mask)) |
+                    (value & DS3231M_EN32KHZ.mask) | (register_ & DS3231M_BSY.mask);
+        break;
+      case DS3231M_TEMPERATURE:
+      case DS3231M_TEMPERATURE + 1:
+        break;  // Read only
+      default:
+        register_ = value;
+    }  // of switch register
+    _pointer = (_pointer + 1) % DS3231M_REGISTERS;
+  }  // for-next each byte
+  return 0;
+}  // of method write()
+uint8_t DS3231M_Sim::read(const uint8_t address, uint8_t* data, const uint8_t len) {
+  /*!
+   @brief     I2C read transaction from the register pointer, which auto-increments
+   @details   The bytes are taken before the clock advances, so they are a coherent image
+   @param[in] address I2C address
+   @param[out] data Buffer for the bytes read
+   @param[in] len Number of bytes to read
+   @return    Number of bytes read
+  */
+  uint8_t count = len;
+  if (address == _address && skipReads) {
+    --skipReads;
+  } else if (address != _address || failReads) {
+    count = 0;
+    failReads -= (address == _address);
+  } else if (shortReads && len) {
+    count = len - 1;
+    --shortReads;
+  }  // if-then-else failure injected
+  ++reads;
+  for (uint8_t i = 0; i < count; ++i) {
+    data[i]  = reg[_pointer];
+    _pointer = (_pointer + 1) % DS3231M_REGISTERS;
+  }  // for-next each byte
+  hostAdvance((count + 1) * byteMicros);
+  reg[DS3231M_STATUS] |= raiseFlags;  // Alarm triggered just after the read
+  raiseFlags = 0;
+  return count;
+}  // of method read()
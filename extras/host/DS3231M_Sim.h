@@ -0,0 +1,86 @@
+/*! @file DS3231M_Sim.h
+
+@section DS3231M_Sim_intro_section Description
+
+Register accurate simulation of the DS3231M (and the DS3231 square wave rates) for the host build.
+The simulator keeps the 19 registers as the device does and follows the data sheet behavior that
+the library depends on:
+- the register pointer auto-increments and wraps from 0x12 to 0x00
+- the time registers are BCD, count once per simulated second and are read as a coherent image,
+  writing the seconds register restarts the 1 second countdown
+- the weekday register counts 1-7 independently of the date
+- the alarm registers and masks set A1F and A2F when they match, A2 on the full minute
+- OSF, A1F and A2F can only be cleared by writing 0, writing 1 leaves them unchanged, BSY is read
+  only and EN32kHz is read/write
+- setting CONV starts a temperature conversion, BSY is set until it completes and CONV clears
+- at power up CONTROL is 0x1C and STATUS has OSF and EN32kHz set
+- the AGING register changes the length of each second by 0.12ppm per step, positive values slow
+  the clock down
+- the INT/SQW falling edges are reported to a callback, at the second rollover for 1Hz and at the
+  1.024, 4.096 and 8.192kHz rates of the DS3231 when "ds3231" is set
+Every transaction moves the simulated clock forward by "byteMicros" per byte including the address
+byte. Failures can be injected for the next transactions: reads returning no data or one byte
+short and writes that are not acknowledged. The read failures can be delayed by a number of reads.
+STATUS flags can be set right after a read, as if an alarm triggered before the next transaction.
+
+The simulator is both a DS3231M_Bus, to be passed to the DS3231M_Class constructor, and a device
+for the host "Wire" bus.
+
+See the library header "DS3231M.h" for the license and the author details.
+*/
+#ifndef DS3231M_Sim_h
+  /*! @brief Guard code definition to prevent multiple definitions */
+  #define DS3231M_Sim_h
+  #include "DS3231M.h"
+
+/*!
+ @brief    Simulated DS3231M on the host
+*/
+class DS3231M_Sim : public DS3231M_Bus, public HostI2CDevice, public HostTimer {
+ public:
+  DS3231M_Sim(const uint8_t address = DS3231M_ADDRESS);  // Power up, registered as a timer
+  ~DS3231M_Sim();                                        // Unregisters the timer
+  void     begin(const uint32_t) {}                      ///< Nothing to start
+  uint8_t  address() { return _address; }                ///< I2C address
+  uint8_t  write(const uint8_t address, const uint8_t reg, const uint8_t* data,
+                 const uint8_t len);                     // I2C write transaction
+  uint8_t  read(const uint8_t address, uint8_t* data, const uint8_t len);  // I2C read transaction
+  uint64_t nextEvent();                                  // Next second, edge or conversion end
+  void     event();                                      // Run the event that is due
+  void     setTime(const uint32_t unixTime);             // Set the time registers directly
+  uint32_t time();                                       // Decode the time registers
+  void     setTemperature(const int32_t temperature);    // Temperature in 1/100 degrees
+  void     onEdge(void (*callback)(void*), void* argument);  // INT/SQW falling edge callback
+
+  uint8_t  reg[DS3231M_REGISTERS];  ///< Register contents, may be changed by the tests
+  bool     ds3231        = false;   ///< Also supply the kHz square wave rates of the DS3231
+  uint32_t secondMicros  = 1000000; ///< Length of a simulated second, to simulate drift
+  uint16_t byteMicros    = 25;      ///< Bus time per byte, 25us is about 400kHz
+  uint32_t convertMicros = 200000;  ///< Duration of a temperature conversion
+  uint8_t  failReads     = 0;       ///< Next reads return no data
+  uint8_t  shortReads    = 0;       ///< Next reads return one byte less than requested
+  uint8_t  skipReads     = 0;       ///< Reads that succeed before failReads/shortReads apply
+  uint8_t  nackWrites    = 0;       ///< Next writes with data are not acknowledged
+  uint8_t  nackAddress   = 0;       ///< Next register pointer writes are not acknowledged
+  uint8_t  raiseFlags    = 0;       ///< STATUS flags the device sets after the next read
+  uint32_t reads         = 0;       ///< Read transactions
+  uint32_t writes        = 0;       ///< Write transactions with data
+
+ private:
+  void     tick();                             // Count one second and check the alarms
+  void     edge();                             // Report a falling edge
+  uint16_t edgeRate();                         // Square wave frequency, 0 for alarms
+  void     startSecond(const uint64_t start);  // Start counting a new second
+  void     encode(const uint32_t unixTime);    // Write the time registers
+  uint8_t  _address;                           ///< I2C address
+  uint8_t  _pointer = 0;                       ///< Register pointer
+  uint64_t _secondStart;                       ///< Simulated time the current second started
+  uint32_t _secondLength;                      ///< Length of the current second, with aging
+  int64_t  _agingResidue = 0;                  ///< Aging adjustment below 1us, in 1e-8 us
+  uint64_t _conversionEnd = 0;  ///< Simulated time the conversion completes, 0 when idle
+  uint32_t _edgeIndex     = 0;  ///< Edges already reported in the current second
+  int32_t  _temperature   = 2500;     ///< Temperature of the next conversion
+  void (*_edgeCallback)(void*) = nullptr;  ///< Falling edge callback
+  void* _edgeArgument          = nullptr;  ///< Argument of the callback
+};                                         // of DS3231M_Sim class definition
+#endif
@@ -0,0 +1,68 @@
+/*! @file HostTest.h
+
+@section HostTest_intro_section Description
+
+Check macros of the host tests. Each test program includes this header once, runs its checks and
+returns hostTestResult() from main(), which is non-zero when any check failed so that "make check"
+stops.
+
+See the library header "DS3231M.h" for the license and the author details.
+*/
+#ifndef HostTest_h
+  /*! @brief Guard code definition to prevent multiple definitions */
+  #define HostTest_h
+  #include <stdio.h>
+
+static unsigned long hostChecks   = 0;  ///< Number of checks made
+static unsigned long hostFailures = 0;  ///< Number of checks that failed
+
+/*! @brief Check that a condition holds */
+  #define CHECK(condition) hostCheck((condition), #condition, __FILE__, __LINE__)
+/*! @brief Check that a value matches the expected integer value */
+  #define CHECK_EQUAL(expected, actual) \
+    hostCheckEqual((long long)(expected), (long long)(actual), #actual, __FILE__, __LINE__)
+
+static bool hostCheck(const bool condition, const char* text, const char* file, const int line) {
+  /*!
+   @brief     counts a check and reports it when it fails
+   @param[in] condition Result of the check
+   @param[in] text Source text of the check
+   @param[in] file Source file
+   @param[in] line Source line
+   @return    condition
+  */
+  ++hostChecks;
+  if (!condition) {
+    ++hostFailures;
+    printf("%s:%d: check failed: %s\n", file, line, text);
+  }  // if-then failed
+  return condition;
+}  // of function hostCheck()
+static bool hostCheckEqual(const long long expected, const long long actual, const char* text,
+                           const char* file, const int line) {
+  /*!
+   @brief     counts a check and reports both values when they differ
+   @param[in] expected Expected value
+   @param[in] actual Actual value
+   @param[in] text Source text of the actual value
+   @param[in] file Source file
+   @param[in] line Source line
+   @return    true if the values are equal
+  */
+  ++hostChecks;
+  if (expected != actual) {
+    ++hostFailures;
+    printf("%s:%d: %s is %lld, expected %lld\n", file, line, text, actual, expected);
+  }  // if-then failed
+  return expected == actual;
+}  // of function hostCheckEqual()
+static int hostTestResult(const char* name) {
+  /*!
+   @brief     prints the summary of a test program
+   @param[in] name Test program name
+   @return    Exit code, 0 when all checks passed
+  */
+  printf("%s: %lu checks, %lu failed\n", name, hostChecks, hostFailures);
+  return hostFailures ? 1 : 0;
+}  // of function hostTestResult()
+#endif
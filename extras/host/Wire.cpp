@@ -0,0 +1,102 @@
+/*!
+ @file Wire.cpp
+ @section Wire_host_cpp_intro_section Description
+ I2C bus of the host build, see "Wire.h"
+*/
+#include "Wire.h"
+
+TwoWire Wire;  ///< Default I2C bus
+
+HostI2CDevice* TwoWire::find(const uint8_t address) {
+  /*!
+   @brief     returns the attached device with an address
+   @param[in] address I2C address
+   @return    Device, nullptr if there is none
+  */
+  for (HostI2CDevice* device : _devices) {
+    if (device && device->address() == address) {
+      return device;
+    }  // if-then address matches
+  }    // for-next each device
+  return nullptr;
+}  // of method find()
+void TwoWire::beginTransmission(const uint8_t address) {
+  /*!
+   @brief     starts collecting the bytes of a write transaction
+   @param[in] address I2C address
+  */
+  _address = address;
+  _length  = 0;
+}  // of method beginTransmission()
+size_t TwoWire::write(const uint8_t data) {
+  /*!
+   @brief     queues a byte of the write transaction
+   @param[in] data Byte
+   @return    1, or 0 when the 32 byte buffer is full
+  */
+  if (_length == sizeof(_buffer)) {
+    return 0;
+  }  // if-then buffer full
+  _buffer[_length++] = data;
+  return 1;
+}  // of method write()
+uint8_t TwoWire::endTransmission(const bool) {
+  /*!
+   @brief     sends the write transaction, the first byte is the register address
+   @return    0 on success, 2 when the address is not acknowledged
+  */
+  HostI2CDevice* device = find(_address);
+  if (device == nullptr || _length == 0) {
+    return 2;
+  }  // if-then nothing at the address
+  return device->write(_address, _buffer[0], _buffer + 1, _length - 1);
+}  // of method endTransmission()
+uint8_t TwoWire::requestFrom(const uint8_t address, const uint8_t quantity) {
+  /*!
+   @brief     reads bytes from the current register pointer of a device
+   @param[in] address I2C address
+   @param[in] quantity Number of bytes
+   @return    Number of bytes read
+  */
+  HostI2CDevice* device = find(address);
+  _index                = 0;
+  _length               = 0;
+  if (device) {
+    _length = device->read(address, _buffer, quantity < sizeof(_buffer) ? quantity : 32);
+  }  // if-then device found
+  return _length;
+}  // of method requestFrom()
+int TwoWire::available() {
+  /*!
+   @brief     returns the bytes left from requestFrom()
+   @return    Number of bytes
+  */
+  return _length - _index;
+}  // of method available()
+int TwoWire::read() {
+  /*!
+   @brief     returns the next byte from requestFrom()
+   @return    Byte, -1 if there is none left
+  */
+  return _index < _length ? _buffer[_index++] : -1;
+}  // of method read()
+void TwoWire::hostAttach(HostI2CDevice* device) {
+  /*!
+   @brief     attaches a simulated device to the bus
+   @param[in] device Device
+  */
+  for (HostI2CDevice*& slot : _devices) {
+    if (slot == nullptr) {
+      slot = device;
+      return;
+    }  // if-then free slot
+  }    // for-next each slot
+}  // of method hostAttach()
+void TwoWire::hostDetach() {
+  /*!
+   @brief     removes all the devices from the bus
+  */
+  for (HostI2CDevice*& slot : _devices) {
+    slot = nullptr;
+  }  // for-next each slot
+}  // of method hostDetach()
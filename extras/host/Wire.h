@@ -0,0 +1,63 @@
+/*! @file Wire.h
+
+@section Wire_host_intro_section Description
+
+Replacement of the Arduino "Wire" I2C library for the host build. Transactions are passed to the
+devices attached with hostAttach(), e.g. the DS3231M simulator, so that the library and the
+examples can use the default "Wire" bus unchanged. Addresses without a device are not acknowledged.
+
+See the library header "DS3231M.h" for the license and the author details.
+*/
+#ifndef Wire_host_h
+  /*! @brief Guard code definition to prevent multiple definitions */
+  #define Wire_host_h
+  #include "Arduino.h"
+
+/*!
+ @brief    Simulated I2C device on the host "Wire" bus, the methods match DS3231M_Bus
+*/
+class HostI2CDevice {
+ public:
+  virtual uint8_t address() = 0;  ///< I2C address of the device
+  /*! @brief   Write the register address followed by "len" bytes of data
+      @param[in] address I2C address
+      @param[in] reg Register address
+      @param[in] data Bytes to write
+      @param[in] len Number of bytes to write
+      @return  Status of the transaction, 0 on success */
+  virtual uint8_t write(const uint8_t address, const uint8_t reg, const uint8_t* data,
+                        const uint8_t len) = 0;
+  /*! @brief   Read "len" bytes from the current register pointer
+      @param[in] address I2C address
+      @param[out] data Buffer for the bytes read
+      @param[in] len Number of bytes to read
+      @return  Number of bytes read */
+  virtual uint8_t read(const uint8_t address, uint8_t* data, const uint8_t len) = 0;
+};  // of HostI2CDevice class definition
+
+/*!
+ @brief    "Wire" compatible I2C bus of the host build
+*/
+class TwoWire {
+ public:
+  void    begin() {}                              ///< Nothing to start
+  void    setClock(const uint32_t) {}             ///< The speed is not simulated
+  void    beginTransmission(const uint8_t address);  // Start a write transaction
+  size_t  write(const uint8_t data);              // Queue a byte to write
+  uint8_t endTransmission(const bool stop = true);   // Send the queued bytes
+  uint8_t requestFrom(const uint8_t address, const uint8_t quantity);  // Read bytes
+  int     available();                            // Bytes left from requestFrom()
+  int     read();                                 // Next byte from requestFrom()
+  void    hostAttach(HostI2CDevice* device);      // Attach a simulated device
+  void    hostDetach();                           // Remove all the devices
+
+ private:
+  HostI2CDevice* find(const uint8_t address);  // Device with the address
+  HostI2CDevice* _devices[4] = {};             ///< Attached devices
+  uint8_t        _address    = 0;              ///< Address of the write transaction
+  uint8_t        _buffer[32];                  ///< Write or read data
+  uint8_t        _length = 0;                  ///< Bytes in the buffer
+  uint8_t        _index  = 0;                  ///< Next byte to return by read()
+};                                             // of TwoWire class definition
+extern TwoWire Wire;                           ///< Default I2C bus
+#endif
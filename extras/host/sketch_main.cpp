@@ -0,0 +1,28 @@
+/*!
+ @file sketch_main.cpp
+ @section sketch_main_intro_section Description
+ Runs an example sketch on the host. A simulated DS3231M is attached to the "Wire" bus, then setup()
+ is called once and loop() until SKETCH_SECONDS of simulated time have passed. Each loop() call
+ takes at least 100us of simulated time, so that sketches whose loop() does no I2C traffic end as
+ well. The serial input holds a "SETDATE" command for the Set example
+*/
+#include "DS3231M_Sim.h"
+
+const uint32_t SKETCH_SECONDS = 30;  ///< Simulated run time of loop()
+
+void setup();  // Defined by the sketch
+void loop();   // Defined by the sketch
+
+int main() {
+  DS3231M_Sim device;
+  Wire.hostAttach(&device);
+  Serial.hostInput("setdate 2024-02-29 23:59:50\n");
+  setup();
+  uint64_t end = hostMicros() + SKETCH_SECONDS * 1000000ULL;
+  while (hostMicros() < end) {
+    loop();
+    hostAdvance(100);
+  }  // of while-loop simulated time left
+  Wire.hostDetach();
+  return 0;
+}  // of function main()
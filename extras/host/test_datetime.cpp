@@ -0,0 +1,185 @@
+/*!
+ @file test_datetime.cpp
+ @section test_datetime_intro_section Description
+ Host checks of DateTime, TimeSpan and PackedDateTime. The conversions are compared with the C
+ library gmtime()/timegm() for every day from 2000 to 2099, the batch conversions and the in-place
+ operators with the scalar conversions, and toString() with parse()
+*/
+#include <time.h>
+
+#include <initializer_list>
+
+#include "DS3231M.h"
+#include "HostTest.h"
+
+static_assert(DateTime(2024, 2, 29, 12, 34, 56).unixtime() == 1709210096, "constexpr unixtime()");
+static_assert(DateTime(2024, 2, 29).dayOfTheWeek() == 4, "constexpr dayOfTheWeek(), Thursday");
+static_assert(DateTime("Feb 29 2024", "12:34:56").unixtime() == 1709210096, "constexpr __DATE__");
+static_assert(TimeSpan(1, 2, 3, 4).totalseconds() == 93784, "constexpr TimeSpan");
+static_assert(DateTime::daysInMonth(2024, 2) == 29 && DateTime::daysInMonth(23, 2) == 28,
+              "constexpr daysInMonth()");
+
+const uint32_t FIRST = SECONDS_FROM_1970_TO_2000;  ///< 2000-01-01 00:00:00
+const uint32_t LAST  = 4102444799UL;               ///< 2099-12-31 23:59:59
+
+static uint32_t seed = 12345;  ///< State of the pseudo random numbers, fixed for repeatability
+static uint32_t random32() {
+  /*!
+   @brief     returns a pseudo random number
+   @return    32 bit number
+  */
+  seed ^= seed << 13;
+  seed ^= seed >> 17;
+  seed ^= seed << 5;
+  return seed;
+}  // of function random32()
+static uint32_t randomTime() {
+  /*!
+   @brief     returns a pseudo random UNIX time from 2000 to 2099
+   @return    UNIX time
+  */
+  return FIRST + random32() % (LAST - FIRST + 1);
+}  // of function randomTime()
+static bool matches(const DateTime& dt, const uint32_t t) {
+  /*!
+   @brief     compares the fields of a DateTime with gmtime()
+   @param[in] dt DateTime
+   @param[in] t UNIX time it should hold
+   @return    true if all the fields match
+  */
+  time_t    value = t;
+  struct tm tm;
+  gmtime_r(&value, &tm);
+  return dt.year() == tm.tm_year + 1900 && dt.month() == tm.tm_mon + 1 && dt.day() == tm.tm_mday &&
+         dt.hour() == tm.tm_hour && dt.minute() == tm.tm_min && dt.second() == tm.tm_sec &&
+         dt.dayOfTheWeek() == (tm.tm_wday ? tm.tm_wday : 7);
+}  // of function matches()
+static void checkConversions() {
+  /*!
+   @brief     DateTime(uint32_t), unixtime() and PackedDateTime against the C library
+  */
+  unsigned long bad = 0;
+  for (uint32_t t = FIRST; t <= LAST - SECONDS_PER_DAY + 1; t += SECONDS_PER_DAY) {
+    for (uint32_t second : {0UL, 1UL, 43199UL, 86399UL}) {
+      DateTime dt(t + second);
+      bad += !matches(dt, t + second) || dt.unixtime() != t + second;
+      bad += dt.secondstime() != (long)(t + second - FIRST);
+      PackedDateTime packed(dt);
+      bad += packed.unixtime() != t + second || packed.year() != dt.year() ||
+             packed.month() != dt.month() || packed.day() != dt.day() ||
+             packed.hour() != dt.hour() || packed.minute() != dt.minute() ||
+             packed.second() != dt.second() || packed.dayOfTheWeek() != dt.dayOfTheWeek();
+      uint8_t frame[7];
+      packed.toRegisters(frame);
+      bad += PackedDateTime::fromRegisters(frame) != packed;
+    }  // for-next each time of the day
+    DateTime day(t);
+    bad += (day.day() == DateTime::daysInMonth(day.year(), day.month())) !=
+           (DateTime(t + SECONDS_PER_DAY).day() == 1);  // Last day of the month
+  }    // for-next each day
+  CHECK_EQUAL(0, bad);
+  CHECK(DateTime(F("Feb 29 2024"), F("12:34:56")).unixtime() == 1709210096);
+  CHECK(DateTime("Jan  1 2000", "00:00:00").unixtime() == FIRST);
+}  // of function checkConversions()
+static void checkBatch() {
+  /*!
+   @brief     the batch conversions give the same results as the scalar ones
+  */
+  const size_t count = 70000;  // More than a uint16_t can count
+  static uint32_t times[count], back[count];
+  static uint16_t years[count];
+  static uint8_t  months[count], days[count], hours[count], minutes[count], seconds[count],
+      weekdays[count];
+  for (size_t i = 0; i < count; ++i) {
+    times[i] = i < 2 ? (i ? LAST : FIRST) : randomTime();
+  }  // for-next each value
+  DateTime::convertUnixtime(times, count, years, months, days, hours, minutes, seconds);
+  DateTime::convertFields(years, months, days, hours, minutes, seconds, count, back);
+  DateTime::daysOfTheWeek(times, count, weekdays);
+  unsigned long bad = 0;
+  for (size_t i = 0; i < count; ++i) {
+    DateTime dt(times[i]);
+    bad += years[i] != dt.year() || months[i] != dt.month() || days[i] != dt.day() ||
+           hours[i] != dt.hour() || minutes[i] != dt.minute() || seconds[i] != dt.second() ||
+           back[i] != times[i] || weekdays[i] != dt.dayOfTheWeek();
+  }  // for-next each value
+  CHECK_EQUAL(0, bad);
+}  // of function checkBatch()
+static void checkOperators() {
+  /*!
+   @brief     += and -= with the field carry give the same fields as the full conversion
+  */
+  static const int32_t spans[] = {1,     -1,     59,     60,      3599,     3600,     86399,
+                                  86400, -86399, -86400, 2419200, -2419200, 31536000, 0};
+  unsigned long        bad     = 0;
+  for (uint32_t i = 0; i < 1000000; ++i) {
+    uint32_t t    = randomTime();
+    int32_t  span = (i & 1) ? spans[i / 2 % (sizeof(spans) / sizeof(spans[0]))]
+                            : (int32_t)(random32() % 172799) - 86399;
+    if ((int64_t)t + span < FIRST || (int64_t)t + span > LAST || (int64_t)t - span < FIRST ||
+        (int64_t)t - span > LAST) {
+      continue;
+    }  // if-then result outside of 2000-2099
+    DateTime sum(t), difference(t);
+    sum += TimeSpan(span);
+    difference -= TimeSpan(span);
+    bad += !matches(sum, t + span) || !matches(difference, t - span);
+    bad += !matches(DateTime(t) + TimeSpan(span), t + span);
+    bad += !matches(DateTime(t) - TimeSpan(span), t - span);
+    bad += (DateTime(t + span) - DateTime(t)).totalseconds() != span;
+  }  // for-next each random case
+  CHECK_EQUAL(0, bad);
+  DateTime dt(2024, 2, 28, 23, 59, 59);  // Carries into the leap day
+  dt += TimeSpan(1);
+  CHECK(dt.unixtime() == DateTime(2024, 2, 29).unixtime());
+  dt += TimeSpan(0, 23, 59, 59);
+  CHECK(dt.month() == 2 && dt.day() == 29 && dt.hour() == 23);
+  dt += TimeSpan(1);  // Carries into March
+  CHECK(dt.unixtime() == DateTime(2024, 3, 1).unixtime());
+  dt -= TimeSpan(1);  // And back
+  CHECK(dt.unixtime() == DateTime(2024, 2, 29, 23, 59, 59).unixtime());
+}  // of function checkOperators()
+static void checkText() {
+  /*!
+   @brief     toString() and parse() in all formats
+  */
+  char     buffer[DS3231M_DATE_TIME_SIZE];
+  DateTime dt(2024, 2, 29, 7, 8, 9);
+  CHECK_EQUAL(19, dt.toString(buffer, sizeof(buffer)));
+  CHECK(strcmp(buffer, "2024-02-29T07:08:09") == 0);
+  CHECK_EQUAL(19, dt.toString(buffer, sizeof(buffer), isoSpaceFormat));
+  CHECK(strcmp(buffer, "2024-02-29 07:08:09") == 0);
+  CHECK_EQUAL(15, dt.toString(buffer, sizeof(buffer), compactFormat));
+  CHECK(strcmp(buffer, "20240229T070809") == 0);
+  CHECK_EQUAL(0, dt.toString(buffer, 19));
+  CHECK(buffer[0] == 0);
+  CHECK_EQUAL(19, DateTime(2024, 200, 31, 255, 100, 99).toString(buffer, sizeof(buffer)));
+  CHECK(strcmp(buffer, "2024-99-31T99:99:99") == 0);  // Invalid fields stay within the table
+  unsigned long bad = 0;
+  for (uint32_t i = 0; i < 100000; ++i) {
+    DateTime original(randomTime()), result;
+    for (dateTimeFormats format : {isoFormat, isoSpaceFormat, compactFormat}) {
+      original.toString(buffer, sizeof(buffer), format);
+      bad += DateTime::parse(buffer, result, format) != parseOk ||
+             result.unixtime() != original.unixtime();
+    }  // for-next each format
+  }    // for-next each random case
+  CHECK_EQUAL(0, bad);
+  DateTime result;
+  CHECK_EQUAL(parseOk, DateTime::parse("2024-02-29 07:08:09Z", result));
+  CHECK_EQUAL(parseRange, DateTime::parse("2023-02-29T07:08:09", result));
+  CHECK_EQUAL(parseRange, DateTime::parse("2024-04-31T07:08:09", result));
+  CHECK_EQUAL(parseRange, DateTime::parse("2024-02-29T24:00:00", result));
+  CHECK_EQUAL(parseRange, DateTime::parse("1999-12-31T23:59:59", result));
+  CHECK_EQUAL(parseSyntax, DateTime::parse("2024-02-29T07:08:0", result));
+  CHECK_EQUAL(parseSyntax, DateTime::parse("2024-02-29T07:08:090", result));
+  CHECK_EQUAL(parseSyntax, DateTime::parse("2024/02/29T07:08:09", result));
+  CHECK_EQUAL(parseSyntax, DateTime::parse("2024-02-29T07:08:09", result, compactFormat));
+}  // of function checkText()
+int main() {
+  checkConversions();
+  checkBatch();
+  checkOperators();
+  checkText();
+  return hostTestResult("test_datetime");
+}  // of function main()
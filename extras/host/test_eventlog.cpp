@@ -0,0 +1,105 @@
+/*!
+ @file test_eventlog.cpp
+ @section test_eventlog_intro_section Description
+ Host checks of DS3231M_EventLog. The simulated INT/SQW edges call edge(), events are captured at
+ known simulated times and time() has to return the second of the simulated clock and the
+ microseconds since that second started. The 1Hz anchor is exact, so the error is the 16us
+ resolution of the records. At the kHz rates of the DS3231 the anchor is accurate to one I2C read
+ of the time registers, the error may not exceed that plus one square wave period
+*/
+#include "DS3231M_Sim.h"
+#include "HostTest.h"
+
+/*!
+ @brief    Edge callback state, remembers when the simulated second started
+*/
+struct EdgeState {
+  DS3231M_Sim*      device;       ///< Simulated DS3231M
+  DS3231M_EventLog* log;          ///< Event log counting the edges
+  uint32_t          second;       ///< Simulated second at the last edge
+  uint64_t          secondStart;  ///< hostMicros() when that second started
+};                                // of struct EdgeState
+static void onEdge(void* argument) {
+  /*!
+   @brief     INT/SQW falling edge, stands in for the interrupt routine
+   @param[in] argument EdgeState
+  */
+  EdgeState* state = (EdgeState*)argument;
+  state->log->edge();
+  if (state->device->time() != state->second) {
+    state->second      = state->device->time();
+    state->secondStart = hostMicros();
+  }  // if-then first edge of a new second
+}  // of function onEdge()
+static void checkRate(const uint8_t rate, const uint32_t tolerance) {
+  /*!
+   @brief     captures events at a square wave rate and checks their times
+   @param[in] rate Square wave rate code, 0 is 1Hz
+   @param[in] tolerance Largest allowed error in microseconds
+  */
+  DS3231M_Sim device;
+  device.ds3231 = true;
+  DS3231M_Class rtc(device);
+  rtc.begin();
+  rtc.adjust(DateTime(2024, 2, 29, 23, 59, 50));
+  DS3231M_EventLog log(rtc);
+  EdgeState        state = {&device, &log, 0, 0};
+  device.onEdge(onEdge, &state);
+  CHECK(log.begin(rate));
+  uint32_t seed = 2024, worst = 0, events = 0;
+  unsigned long bad = 0;
+  for (uint32_t i = 0; i < 2000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    hostAdvance(1 + (seed >> 8) % 40000);  // Up to 40ms between events, crosses many seconds
+    uint32_t second = device.time();
+    uint32_t micro  = hostMicros() - state.secondStart;
+    log.capture(i & 3);
+    DS3231M_Event event;
+    CHECK(log.read(event));
+    CHECK_EQUAL(i & 3, event.channel);
+    uint32_t microseconds;
+    int64_t  error = ((int64_t)log.time(event, microseconds).unixtime() - second) * 1000000 +
+                    microseconds - micro;
+    uint32_t size = error < 0 ? -error : error;
+    worst         = size > worst ? size : worst;
+    bad += size > tolerance;
+    ++events;
+  }  // for-next each event
+  CHECK_EQUAL(0, bad);
+  CHECK_EQUAL(0, log.dropped());
+  Serial.print(F("  rate "));
+  Serial.print(rate);
+  Serial.print(F(": "));
+  Serial.print(events);
+  Serial.print(F(" events, largest error "));
+  Serial.print(worst);
+  Serial.println(F("us"));
+  device.onEdge(nullptr, nullptr);
+}  // of function checkRate()
+static void checkQueue() {
+  /*!
+   @brief     a full ring buffer drops and counts the events, the oldest are kept in order
+  */
+  DS3231M_Sim      device;
+  DS3231M_Class    rtc(device);
+  DS3231M_EventLog log(rtc);
+  for (uint8_t i = 0; i < DS3231M_EVENT_QUEUE + 4; ++i) {
+    log.capture(i);
+  }  // for-next fill past the end
+  CHECK_EQUAL(DS3231M_EVENT_QUEUE - 1, log.available());
+  CHECK_EQUAL(5, log.dropped());
+  DS3231M_Event event;
+  for (uint8_t i = 0; i < DS3231M_EVENT_QUEUE - 1; ++i) {
+    CHECK(log.read(event) && event.channel == i);
+  }  // for-next each record
+  CHECK(!log.read(event));
+}  // of function checkQueue()
+int main() {
+  const uint32_t readMicros = 11 * 25;  // Pointer write and 7 byte read of the time at 25us/byte
+  checkRate(0, 16);
+  checkRate(1, readMicros + 1000000 / 1024);
+  checkRate(2, readMicros + 1000000 / 4096);
+  checkRate(3, readMicros + 1000000 / 8192);
+  checkQueue();
+  return hostTestResult("test_eventlog");
+}  // of function main()
@@ -0,0 +1,436 @@
+/*!
+ @file test_registers.cpp
+ @section test_registers_intro_section Description
+ Host checks of DS3231M_Class and the classes built on it against the simulated DS3231M: the
+ register images written by adjust() and setAlarm(), the alarm flags, the register shadow copy,
+ snapshot(), readTime() validation and retries, the time base, the temperature conversion, the
+ non-blocking requests, the scheduler, the aging calibration, a group of clocks and a year of
+ alarms and aging drift
+*/
+#include <initializer_list>
+
+#include "DS3231M_Sim.h"
+#include "HostTest.h"
+
+const DateTime LEAP_DAY(2024, 2, 29, 23, 59, 50);  ///< Time used by most of the checks
+
+static void checkTime() {
+  /*!
+   @brief     begin(), adjust(), now() and the BCD counting with rollover
+  */
+  DS3231M_Sim   device;
+  DS3231M_Class rtc(device);
+  DS3231M_Class missing(device, 0x57);
+  CHECK(rtc.begin());
+  CHECK(!missing.begin());
+  rtc.resetCounters();
+  rtc.adjust(LEAP_DAY);
+  CHECK_EQUAL(1, rtc.readCount());   // CONTROL and STATUS in one burst
+  CHECK_EQUAL(2, rtc.writeCount());  // Time registers, then CONTROL and STATUS
+  CHECK_EQUAL(LEAP_DAY.unixtime(), device.time());
+  CHECK_EQUAL(4, device.reg[DS3231M_RTCWKDAY]);  // Thursday
+  CHECK_EQUAL(0x1C, device.reg[DS3231M_CONTROL]);
+  CHECK_EQUAL(0x08, device.reg[DS3231M_STATUS]);  // OSF cleared, EN32kHz kept
+  CHECK(!rtc.isStopped());
+  CHECK_EQUAL(LEAP_DAY.unixtime(), rtc.lastSet());
+  hostAdvance(10 * 1000000ULL);
+  CHECK_EQUAL(DateTime(2024, 3, 1).unixtime(), rtc.now().unixtime());
+  CHECK_EQUAL(5, rtc.weekdayRead());  // Counted at midnight
+  CHECK_EQUAL(0x00, device.reg[DS3231M_RTCSEC]);
+  CHECK_EQUAL(0x03, device.reg[DS3231M_RTCMTH]);
+  CHECK(rtc.nowPacked() == PackedDateTime(DateTime(2024, 3, 1)));
+  CHECK_EQUAL(7, rtc.weekdayWrite(7));
+  CHECK_EQUAL(0, rtc.weekdayWrite(8));
+  CHECK_EQUAL(7, rtc.weekdayRead());
+  device.setTime(DateTime(2099, 12, 31, 23, 59, 59).unixtime());
+  hostAdvance(1000000);
+  CHECK_EQUAL(0x00, device.reg[DS3231M_RTCYEAR]);  // Century rollover
+  CHECK_EQUAL(0x81, device.reg[DS3231M_RTCMTH]);   // Century bit
+}  // of function checkTime()
+static void checkAlarms() {
+  /*!
+   @brief     setAlarm() register images, the flags, isAlarm(), clearAlarm() and serviceAlarms()
+  */
+  DS3231M_Sim   device;
+  DS3231M_Class rtc(device);
+  rtc.begin();
+  rtc.adjust(LEAP_DAY);
+  rtc.setAlarm(secondsMinutesHoursDateMatch, DateTime(2024, 3, 1, 0, 0, 5));
+  CHECK_EQUAL(0x05, device.reg[DS3231M_ALM1SEC]);
+  CHECK_EQUAL(0x00, device.reg[DS3231M_ALM1MIN]);
+  CHECK_EQUAL(0x00, device.reg[DS3231M_ALM1HOUR]);
+  CHECK_EQUAL(0x01, device.reg[DS3231M_ALM1DATE]);
+  CHECK_EQUAL(0x1D, device.reg[DS3231M_CONTROL]);  // A1IE
+  rtc.setAlarm(minutesHoursDayMatch, DateTime(2024, 3, 1, 0, 1));
+  CHECK_EQUAL(0x01, device.reg[DS3231M_ALM2MIN]);
+  CHECK_EQUAL(0x00, device.reg[DS3231M_ALM2HOUR]);
+  CHECK_EQUAL(0x45, device.reg[DS3231M_ALM2DATE]);  // DY/DT, Friday
+  CHECK_EQUAL(0x1F, device.reg[DS3231M_CONTROL]);   // A1IE and A2IE
+  hostAdvance(14 * 1000000ULL);
+  CHECK(!rtc.isAlarm());
+  hostAdvance(1000000);
+  CHECK(rtc.isAlarm());
+  CHECK_EQUAL(DS3231M_A1F.mask, device.reg[DS3231M_STATUS] & 0x03);
+  hostAdvance(60 * 1000000ULL);  // Alarm 2 at 00:01:00
+  CHECK_EQUAL(0x03, device.reg[DS3231M_STATUS] & 0x03);
+  device.reg[DS3231M_CONTROL] &= ~DS3231M_A2IE.mask;  // Only alarm 1 is serviced
+  CHECK_EQUAL(DS3231M_ALARM1, rtc.serviceAlarms());
+  CHECK_EQUAL(DS3231M_A2F.mask, device.reg[DS3231M_STATUS] & 0x03);
+  CHECK_EQUAL(0, rtc.serviceAlarms());
+  rtc.clearAlarm();
+  CHECK_EQUAL(0x00, device.reg[DS3231M_STATUS] & 0x03);
+  rtc.setAlarm(everySecond, LEAP_DAY);
+  CHECK_EQUAL(0x80, device.reg[DS3231M_ALM1SEC] & 0x80);
+  CHECK_EQUAL(0x80, device.reg[DS3231M_ALM1DATE] & 0x80);
+  hostAdvance(1000000);
+  CHECK_EQUAL(DS3231M_ALARM1, rtc.serviceAlarms());
+  rtc.setAlarm(UnknownAlarm, LEAP_DAY);  // Ignored
+  CHECK_EQUAL(0x80, device.reg[DS3231M_ALM1SEC] & 0x80);
+  rtc.pinSquareWave();
+  CHECK_EQUAL(0x00, device.reg[DS3231M_CONTROL] & 0x1C);
+  rtc.pinAlarm();
+  CHECK_EQUAL(0x04, device.reg[DS3231M_CONTROL] & 0x1C);
+  rtc.kHz32(false);
+  CHECK_EQUAL(0x00, device.reg[DS3231M_STATUS] & DS3231M_EN32KHZ.mask);
+}  // of function checkAlarms()
+static void checkShadow() {
+  /*!
+   @brief     register shadow copy, snapshot() and the aging offset
+  */
+  DS3231M_Sim   device;
+  DS3231M_Class rtc(device);
+  rtc.begin();
+  rtc.adjust(LEAP_DAY);
+  CHECK(rtc.refresh());
+  rtc.resetCounters();
+  CHECK_EQUAL(0, rtc.getAgingOffset());
+  CHECK_EQUAL(0, rtc.readCount());  // Served from the shadow copy
+  CHECK_EQUAL(-5, rtc.setAgingOffset(-5));
+  CHECK_EQUAL(0, rtc.readCount());
+  CHECK_EQUAL(1, rtc.writeCount());
+  CHECK_EQUAL(0xFB, device.reg[DS3231M_AGING]);
+  device.nackWrites = 1;
+  CHECK_EQUAL(-5, rtc.setAgingOffset(7));  // Not acknowledged, read back from the device
+  CHECK_EQUAL(-5, rtc.getAgingOffset());
+  CHECK_EQUAL(2, rtc.readCount());
+  CHECK(rtc.refresh());
+  rtc.resetCounters();
+  rtc.pinSquareWave();
+  CHECK_EQUAL(0, rtc.readCount());
+  CHECK_EQUAL(0x00, device.reg[DS3231M_CONTROL]);
+  device.reg[DS3231M_STATUS] |= DS3231M_A1F.mask;  // Set by the device after the refresh()
+  rtc.resetCounters();
+  rtc.kHz32(false);
+  rtc.kHz32(false);  // Already off
+  CHECK_EQUAL(0, rtc.readCount());
+  CHECK_EQUAL(1, rtc.writeCount());
+  CHECK_EQUAL(DS3231M_A1F.mask, device.reg[DS3231M_STATUS] & 0x0B);  // EN32kHz off, A1F kept
+  rtc.kHz32(true);
+  CHECK_EQUAL(DS3231M_A1F.mask | DS3231M_EN32KHZ.mask, device.reg[DS3231M_STATUS] & 0x0B);
+  device.reg[DS3231M_STATUS] &= ~DS3231M_A1F.mask;
+  device.setTemperature(-1025);
+  DS3231M_Snapshot snap;
+  CHECK(rtc.snapshot(snap));
+  CHECK_EQUAL(LEAP_DAY.unixtime(), snap.time.unixtime());
+  CHECK_EQUAL(4, snap.weekday);
+  CHECK_EQUAL(-5, snap.agingOffset);
+  CHECK_EQUAL(-1025, snap.temperature);
+  CHECK(!snap.pinAlarm && snap.kHz32 && !snap.stopped);
+  rtc.invalidate();
+  device.failReads = 1;
+  CHECK(!rtc.snapshot(snap));
+  rtc.resetCounters();
+  device.failReads = 1;
+  rtc.pinAlarm();  // One register, read fails
+  device.shortReads = 1;
+  device.reg[DS3231M_CONTROL] = 0x80;  // EOSC set
+  device.reg[DS3231M_STATUS] |= 0x80;  // OSF set
+  rtc.adjust(LEAP_DAY);                // CONTROL and STATUS, read is 1 byte short
+  device.nackAddress = 2;              // Time registers written, then the pointer write fails
+  rtc.adjust(LEAP_DAY);
+  CHECK_EQUAL(2, rtc.writeCount());  // Only the time registers, nothing written back
+  CHECK_EQUAL(0x80, device.reg[DS3231M_CONTROL]);
+  CHECK_EQUAL(0x88, device.reg[DS3231M_STATUS]);
+}  // of function checkShadow()
+static void checkReadTime() {
+  /*!
+   @brief     readTime() validation, retries and backoff
+  */
+  DS3231M_Sim   device;
+  DS3231M_Class rtc(device);
+  rtc.begin();
+  rtc.adjust(LEAP_DAY);
+  DateTime dt;
+  device.failReads = 1;
+  CHECK(rtc.readTime(dt));
+  CHECK_EQUAL(LEAP_DAY.unixtime(), dt.unixtime());
+  device.shortReads = 2;
+  CHECK(rtc.readTime(dt));
+  device.failReads = 4;
+  CHECK(!rtc.readTime(dt, 3));
+  CHECK_EQUAL(0, device.failReads);
+  device.nackAddress = 1;
+  CHECK(rtc.readTime(dt, 1));
+  uint64_t start   = hostMicros();
+  device.failReads = 21;  // The delays double up to DS3231M_RETRY_DELAY_MAX and then stay there
+  CHECK(!rtc.readTime(dt, 20));
+  uint32_t waited  = 25500 + 12 * (uint32_t)DS3231M_RETRY_DELAY_MAX;  // 100..12800, then 12 more
+  uint64_t elapsed = hostMicros() - start;
+  CHECK(elapsed >= waited && elapsed < waited + 21 * 500);  // Plus the bus time of 21 reads
+  device.reg[DS3231M_RTCDATE] = 0x30;  // February 30th
+  CHECK(!rtc.readTime(dt, 0));
+  device.reg[DS3231M_RTCDATE] = 0x1A;  // Not BCD
+  CHECK(!rtc.readTime(dt, 0));
+}  // of function checkReadTime()
+static uint64_t secondStart;  ///< hostMicros() when the current simulated second started
+static void checkTimeBase() {
+  /*!
+   @brief     the interpolated time base of now() is anchored to a valid read at the start of a
+              second, so the milliseconds are the phase of the RTC second and never go backwards
+  */
+  DS3231M_Sim   device;
+  DS3231M_Class rtc(device);
+  rtc.begin();
+  rtc.adjust(LEAP_DAY);
+  rtc.timeBase(60000);
+  uint16_t milliseconds;
+  CHECK_EQUAL(LEAP_DAY.unixtime() + 1, rtc.now(milliseconds).unixtime());  // At the change
+  CHECK_EQUAL(0, milliseconds);
+  CHECK_EQUAL(0, rtc.timeBaseAge());
+  CHECK_EQUAL(1, rtc.timeBaseError());
+  hostAdvance(2500000);
+  rtc.resetCounters();
+  CHECK_EQUAL(LEAP_DAY.unixtime() + 3, rtc.now(milliseconds).unixtime());
+  CHECK_EQUAL(500, milliseconds);
+  CHECK_EQUAL(0, rtc.readCount());  // Served from the anchor
+  rtc.timeBase(60000);
+  device.failReads = DS3231M_READ_RETRIES + 1;
+  rtc.now(milliseconds);
+  CHECK_EQUAL(0xFFFFFFFF, rtc.timeBaseAge());  // Failed read is not an anchor
+  device.reg[DS3231M_RTCDATE] = 0x30;          // February 30th
+  rtc.now(milliseconds);
+  CHECK_EQUAL(0xFFFFFFFF, rtc.timeBaseAge());
+  device.reg[DS3231M_RTCDATE] = 0x29;
+  rtc.pinSquareWave();  // The edges only give the true phase to the check, not to the library
+  device.onEdge([](void*) { secondStart = hostMicros(); }, nullptr);
+  rtc.timeBase(700);  // Re-anchored at many different phases
+  uint32_t seed = 4, worst = 0;
+  uint64_t last = 0;
+  unsigned long bad = 0;
+  for (uint16_t i = 0; i < 1000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    hostAdvance(1000 + (seed >> 8) % 400000);
+    uint64_t value = rtc.now(milliseconds).unixtime() * 1000ULL + milliseconds;
+    uint64_t truth = device.time() * 1000ULL + (hostMicros() - secondStart) / 1000;
+    uint32_t error = value > truth ? value - truth : truth - value;
+    worst          = error > worst ? error : worst;
+    bad += value < last;  // Never backwards
+    last = value;
+  }  // for-next each reading
+  device.onEdge(nullptr, nullptr);
+  CHECK_EQUAL(0, bad);
+  CHECK(worst <= 1);  // millis() resolution
+}  // of function checkTimeBase()
+static void checkTemperature() {
+  /*!
+   @brief     temperature(), startConversion() and readConversion()
+  */
+  DS3231M_Sim   device;
+  DS3231M_Class rtc(device);
+  rtc.begin();
+  CHECK_EQUAL(2500, rtc.temperature());
+  device.setTemperature(-1025);
+  CHECK_EQUAL(-1025, rtc.temperature());
+  device.setTemperature(3150);
+  CHECK(rtc.startConversion());
+  CHECK(!rtc.startConversion());  // Busy
+  int32_t temp = 0;
+  CHECK(!rtc.readConversion(temp));
+  hostAdvance(device.convertMicros);
+  CHECK(rtc.readConversion(temp));
+  CHECK_EQUAL(3150, temp);
+  CHECK_EQUAL(0x1C, device.reg[DS3231M_CONTROL]);
+  device.shortReads = 1;
+  CHECK(!rtc.startConversion());
+  device.nackAddress = 1;
+  CHECK(!rtc.startConversion());
+  CHECK_EQUAL(0x1C, device.reg[DS3231M_CONTROL]);  // No conversion started
+  CHECK(rtc.startConversion());
+  hostAdvance(device.convertMicros);
+  device.nackAddress = 1;
+  CHECK(!rtc.readConversion(temp));
+  DS3231M_TemperatureLog log;
+  for (int32_t t : {2000, 2500, 1500, 3000}) {
+    log.add(LEAP_DAY.unixtime(), t);
+  }  // for-next each sample
+  CHECK_EQUAL(4, log.count());
+  CHECK_EQUAL(1500, log.minimum());
+  CHECK_EQUAL(3000, log.maximum());
+  CHECK_EQUAL(2250, log.mean());
+}  // of function checkTemperature()
+static uint8_t asyncDone = 0;  ///< Requests completed
+static void checkAsync() {
+  /*!
+   @brief     non-blocking requests take two pollAsync() calls each
+  */
+  DS3231M_Sim   device;
+  DS3231M_Class rtc(device);
+  rtc.begin();
+  rtc.adjust(LEAP_DAY);
+  CHECK(rtc.requestAsync(timeRequest, [](const uint8_t) { ++asyncDone; }));
+  CHECK(rtc.requestAsync(temperatureRequest, [](const uint8_t) { ++asyncDone; }));
+  CHECK(rtc.requestAsync(statusRequest));
+  CHECK(!rtc.requestAsync(UnknownRequest));
+  uint8_t polls = 0;
+  while (rtc.pollAsync()) {
+    ++polls;
+  }  // of while-loop requests left
+  CHECK_EQUAL(5, polls);
+  CHECK_EQUAL(2, asyncDone);
+  CHECK_EQUAL(LEAP_DAY.unixtime(), rtc.asyncTime().unixtime());
+  CHECK_EQUAL(2500, rtc.asyncTemperature());
+  CHECK_EQUAL(0x08, rtc.asyncStatus());
+  CHECK(rtc.asyncSuccess());
+  device.setTemperature(-500);
+  device.nackAddress = 1;
+  rtc.requestAsync(temperatureRequest);
+  CHECK_EQUAL(0, rtc.pollAsync());  // Completes without a read
+  CHECK(!rtc.asyncSuccess());
+  CHECK_EQUAL(2500, rtc.asyncTemperature());
+  uint32_t reads = device.reads;
+  rtc.requestAsync(timeRequest);
+  rtc.pollAsync();
+  device.shortReads = 1;
+  CHECK_EQUAL(0, rtc.pollAsync());
+  CHECK(!rtc.asyncSuccess());
+  CHECK_EQUAL(reads + 1, device.reads);
+  device.reg[DS3231M_RTCDATE] = 0x30;  // February 30th
+  rtc.requestAsync(timeRequest);
+  while (rtc.pollAsync()) {
+  }  // of while-loop request left
+  CHECK(!rtc.asyncSuccess());
+  CHECK_EQUAL(LEAP_DAY.unixtime(), rtc.asyncTime().unixtime());
+}  // of function checkAsync()
+static uint32_t dispatched[4];   ///< UNIX time each scheduler event was dispatched
+static uint32_t schedulerNow;    ///< Time of the current service() call
+static void checkScheduler() {
+  /*!
+   @brief     the scheduler dispatches its events in deadline order through alarm 1
+  */
+  DS3231M_Sim       device;
+  DS3231M_Class     rtc(device);
+  DS3231M_Scheduler scheduler(rtc);
+  rtc.begin();
+  rtc.adjust(LEAP_DAY);
+  scheduler.begin();
+  rtc.setAlarm(everyMinute, LEAP_DAY, false);  // Alarm 2 is polled by the sketch
+  auto record = [](const uint8_t handle) { dispatched[handle] = schedulerNow; };
+  CHECK_EQUAL(DS3231M_SCHEDULER_FULL, scheduler.add(LEAP_DAY, nullptr));
+  CHECK_EQUAL(0, scheduler.add(LEAP_DAY + TimeSpan(30), record));
+  CHECK_EQUAL(1, scheduler.add(LEAP_DAY + TimeSpan(5), record));
+  CHECK_EQUAL(2, scheduler.add(LEAP_DAY + TimeSpan(20), record));
+  CHECK_EQUAL(3, scheduler.add(LEAP_DAY + TimeSpan(10), record));
+  CHECK(scheduler.cancel(2));
+  CHECK(!scheduler.cancel(2));
+  CHECK_EQUAL(3, scheduler.pending());
+  for (uint8_t second = 0; second < 40; ++second) {
+    hostAdvance(1000000);
+    if (device.reg[DS3231M_STATUS] & DS3231M_A1F.mask) {
+      scheduler.alarmInterrupt();  // INT/SQW went low
+    }                              // if-then alarm 1
+    schedulerNow = device.time();
+    scheduler.service();
+  }  // for-next each second
+  CHECK_EQUAL(0, scheduler.pending());
+  CHECK_EQUAL(LEAP_DAY.unixtime() + 30, dispatched[0]);
+  CHECK_EQUAL(LEAP_DAY.unixtime() + 5, dispatched[1]);
+  CHECK_EQUAL(0, dispatched[2]);
+  CHECK_EQUAL(LEAP_DAY.unixtime() + 10, dispatched[3]);
+  CHECK_EQUAL(DS3231M_A2F.mask, device.reg[DS3231M_STATUS] & 0x03);  // A2F of 00:00:00 kept
+  rtc.clearAlarm(DS3231M_ALARM2);
+  CHECK_EQUAL(0, device.reg[DS3231M_STATUS] & 0x03);
+  device.reg[DS3231M_STATUS] |= DS3231M_A1F.mask;
+  device.raiseFlags = DS3231M_A2F.mask | DS3231M_OSF.mask;  // Set between the read and the write
+  rtc.clearAlarm(DS3231M_ALARM1);
+  CHECK_EQUAL(DS3231M_A2F.mask | DS3231M_OSF.mask, device.reg[DS3231M_STATUS] & 0x83);
+  device.reg[DS3231M_STATUS] &= ~DS3231M_A2F.mask;
+  device.raiseFlags = DS3231M_A2F.mask;
+  scheduler.add(device.time() + 5, record);  // arm() clears A1F only
+  CHECK_EQUAL(DS3231M_A2F.mask, device.reg[DS3231M_STATUS] & 0x03);
+}  // of function checkScheduler()
+static void checkCalibration() {
+  /*!
+   @brief     calibrate() corrects the aging offset, but never from an offset it could not read
+  */
+  DS3231M_Sim         device;
+  DS3231M_Class       rtc(device);
+  DS3231M_Calibration calibration(rtc);
+  rtc.begin();
+  rtc.setAgingOffset(-5);
+  for (uint32_t i = 0; i < 3; ++i) {
+    calibration.addSample(1000 * i, 0, 1000 * i, i, 2500);  // 1ms fast per 1000s, 1ppm
+  }  // for-next each sample
+  device.failReads = 1;
+  CHECK_EQUAL(0, calibration.calibrate());
+  CHECK_EQUAL(0xFB, device.reg[DS3231M_AGING]);  // Unchanged
+  CHECK_EQUAL(3, calibration.samples());         // Kept for the next attempt
+  CHECK_EQUAL(3, calibration.calibrate());       // -5 + 8 steps of 0.12ppm
+  CHECK_EQUAL(3, device.reg[DS3231M_AGING]);
+  CHECK_EQUAL(0, calibration.samples());
+}  // of function checkCalibration()
+static void checkGroup() {
+  /*!
+   @brief     a group of clocks reports the spread between them
+  */
+  DS3231M_Sim   first, second;
+  DS3231M_Class rtc1(first), rtc2(second);
+  first.setTime(LEAP_DAY.unixtime());
+  second.setTime(LEAP_DAY.unixtime() + 3);
+  DS3231M_Group group;
+  CHECK_EQUAL(0, group.add(rtc1));
+  CHECK_EQUAL(1, group.add(rtc2));
+  CHECK_EQUAL(0x03, group.poll());  // Both read
+  CHECK_EQUAL(3, group.spread());
+  CHECK_EQUAL(LEAP_DAY.unixtime(), group.time(0).unixtime());
+}  // of function checkGroup()
+static void checkYear() {
+  /*!
+   @brief     a simulated year with a monthly alarm 2 and a slowed down clock
+   @details   The aging offset of +100 lengthens every second by 12ppm, so after 365 days of the
+              host clock the RTC is 378 seconds behind
+  */
+  DS3231M_Sim   device;
+  DS3231M_Class rtc(device);
+  rtc.begin();
+  rtc.adjust(DateTime(2025, 1, 1));
+  rtc.setAlarm(minutesHoursDateMatch, DateTime(2025, 1, 15, 12, 0));
+  uint8_t alarms = 0;
+  for (uint16_t day = 0; day < 365; ++day) {
+    hostAdvance(SECONDS_PER_DAY * 1000000ULL);
+    alarms += rtc.serviceAlarms() == DS3231M_ALARM2;
+  }  // for-next each day
+  CHECK_EQUAL(12, alarms);
+  CHECK_EQUAL(DateTime(2026, 1, 1).unixtime(), rtc.now().unixtime());
+  rtc.adjust(DateTime(2025, 1, 1));
+  rtc.setAgingOffset(100);
+  uint64_t start = hostMicros();
+  while (hostMicros() - start < 365ULL * SECONDS_PER_DAY * 1000000) {
+    hostAdvance(SECONDS_PER_DAY * 1000000ULL);
+  }  // of while-loop a year of host time
+  int32_t behind = DateTime(2026, 1, 1).unixtime() - rtc.now().unixtime();
+  CHECK(behind >= 377 && behind <= 379);
+}  // of function checkYear()
+int main() {
+  checkTime();
+  checkAlarms();
+  checkShadow();
+  checkReadTime();
+  checkTimeBase();
+  checkTemperature();
+  checkAsync();
+  checkScheduler();
+  checkCalibration();
+  checkGroup();
+  checkYear();
+  return hostTestResult("test_registers");
+}  // of function main()
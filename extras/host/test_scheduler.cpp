@@ -0,0 +1,59 @@
+/*!
+ @file test_scheduler.cpp
+ @section test_scheduler_intro_section Description
+ Host check of DS3231M_Scheduler with more events than a 1 byte handle can address. The Makefile
+ compiles this check and the library with "-DDS3231M_SCHEDULER_SIZE=400"
+*/
+#include "DS3231M_Sim.h"
+#include "HostTest.h"
+
+static_assert(DS3231M_SCHEDULER_SIZE == 400, "Compiled with the Makefile setting");
+static_assert(sizeof(schedulerHandle) == 2, "Handles above 254 events are 2 bytes");
+
+const DateTime  START(2024, 2, 29, 23, 50);          ///< RTC time when the events are added
+static uint32_t dispatched[DS3231M_SCHEDULER_SIZE];  ///< UNIX time each event was dispatched
+static uint32_t schedulerNow;                        ///< Time of the current service() call
+
+static uint32_t deadlineOf(const schedulerHandle handle) {
+  /*!
+   @brief     returns the deadline of an event, each handle gets a different second in 1-400
+   @param[in] handle Event handle
+   @return    UNIX time deadline
+  */
+  return START.unixtime() + 1 + (handle * 7919UL) % DS3231M_SCHEDULER_SIZE;
+}  // of function deadlineOf()
+int main() {
+  DS3231M_Sim       device;
+  DS3231M_Class     rtc(device);
+  DS3231M_Scheduler scheduler(rtc);
+  rtc.begin();
+  rtc.adjust(START);
+  scheduler.begin();
+  auto          record = [](const schedulerHandle handle) { dispatched[handle] = schedulerNow; };
+  unsigned long bad    = 0;
+  for (schedulerHandle i = 0; i < DS3231M_SCHEDULER_SIZE; ++i) {
+    bad += scheduler.add(DateTime(deadlineOf(i)), record) != i;
+  }  // for-next each event
+  CHECK_EQUAL(0, bad);
+  CHECK_EQUAL(DS3231M_SCHEDULER_FULL, scheduler.add(START, record));
+  for (schedulerHandle i = 0; i < DS3231M_SCHEDULER_SIZE; i += 10) {
+    bad += !scheduler.cancel(i);
+  }  // for-next every 10th event
+  CHECK_EQUAL(0, bad);
+  CHECK(!scheduler.cancel(300) && !scheduler.cancel(DS3231M_SCHEDULER_SIZE));
+  CHECK_EQUAL(DS3231M_SCHEDULER_SIZE - 40, scheduler.pending());
+  for (uint16_t second = 0; second < DS3231M_SCHEDULER_SIZE + 10; ++second) {
+    hostAdvance(1000000);
+    if (device.reg[DS3231M_STATUS] & DS3231M_A1F.mask) {
+      scheduler.alarmInterrupt();  // INT/SQW went low
+    }                              // if-then alarm 1
+    schedulerNow = device.time();
+    scheduler.service();
+  }  // for-next each second
+  CHECK_EQUAL(0, scheduler.pending());
+  for (schedulerHandle i = 0; i < DS3231M_SCHEDULER_SIZE; ++i) {
+    bad += dispatched[i] != (i % 10 ? deadlineOf(i) : 0);
+  }  // for-next each event
+  CHECK_EQUAL(0, bad);
+  return hostTestResult("test_scheduler");
+}  // of function main()
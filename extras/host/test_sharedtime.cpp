@@ -0,0 +1,162 @@
+/*!
+ @file test_sharedtime.cpp
+ @section test_sharedtime_intro_section Description
+ Stress check of the DS3231M_SharedTime sequence lock with std::thread. One writer thread owns the
+ simulated bus and is the only one that advances the simulated clock. Before each refresh() it
+ moves the RTC 1000 seconds further and sets a temperature derived from the refresh number, so a
+ copy that mixes two refreshes shows up as a temperature that does not belong to the time. The
+ reader threads also check that the milliseconds elapsed since the refresh are possible. The reader
+ throughput and the number of repeated copies are printed. On a single core host a reader only
+ overlaps the few stores of refresh() when it is preempted there, so torn copies of a broken lock
+ are found in some runs only, on several cores in practically every run
+*/
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "DS3231M_Sim.h"
+#include "HostTest.h"
+
+const uint32_t REFRESHES = 1000000;                         ///< Refreshes done by the writer
+const uint8_t  READERS   = 3;                               ///< Reader threads
+const uint32_t BASE      = DateTime(2001, 1, 1).unixtime();  ///< RTC time of refresh 0
+
+static std::atomic<uint32_t> refreshMillis[REFRESHES];  ///< millis() before each refresh
+static std::atomic<bool>     done(false);               ///< Writer has finished
+
+static int32_t temperatureOf(const uint32_t refresh) {
+  /*!
+   @brief     returns the temperature set for a refresh
+   @param[in] refresh Refresh number
+   @return    Temperature in 1/100 degrees Celsius, a multiple of 0.25 degrees
+  */
+  return (int32_t)(refresh % 512) * 25;
+}  // of function temperatureOf()
+static void writer(DS3231M_Sim* device, DS3231M_SharedTime* shared, unsigned long* bad) {
+  /*!
+   @brief     bus owner, refreshes the shared values
+   @param[in] device Simulated DS3231M
+   @param[in] shared Published values
+   @param[out] bad Failed refreshes
+  */
+  for (uint32_t refresh = 0; refresh < REFRESHES; ++refresh) {
+    hostAdvance(1000);  // 1ms between refreshes, so each one has a later millis()
+    device->setTime(BASE + refresh * 1000);
+    device->setTemperature(temperatureOf(refresh));
+    refreshMillis[refresh].store(millis());
+    *bad += !shared->refresh();
+  }  // for-next each refresh
+  done.store(true);
+}  // of function writer()
+static void reader(DS3231M_SharedTime* shared, unsigned long* reads, unsigned long* bad) {
+  /*!
+   @brief     copies the shared values until the writer is done and checks each copy
+   @param[in] shared Published values
+   @param[out] reads Number of copies
+   @param[out] bad Inconsistent copies
+  */
+  while (!done.load()) {
+    uint32_t unixTime;
+    uint16_t milliseconds;
+    int32_t  temperature;
+    if (!shared->read(unixTime, milliseconds, temperature)) {
+      continue;
+    }  // if-then nothing published yet
+    uint32_t current = millis();
+    uint32_t refresh = (unixTime - BASE) / 1000;
+    uint32_t elapsed = (unixTime - BASE) % 1000 * 1000 + milliseconds;  // Since the refresh
+    *bad += refresh >= REFRESHES || temperature != temperatureOf(refresh) ||
+            elapsed > current - refreshMillis[refresh].load();
+    ++*reads;
+  }  // of while-loop writer running
+}  // of function reader()
+static void checkFailures() {
+  /*!
+   @brief     refresh() only publishes complete and valid reads
+  */
+  DS3231M_Sim        device;
+  DS3231M_Class      rtc(device);
+  DS3231M_SharedTime shared(rtc);
+  rtc.begin();
+  device.setTime(BASE);
+  device.setTemperature(2025);
+  CHECK(shared.refresh());
+  device.setTime(BASE + 100);
+  device.setTemperature(-500);
+  device.failReads = DS3231M_READ_RETRIES + 1;  // Time read fails
+  CHECK(!shared.refresh());
+  device.skipReads  = 1;  // Time read succeeds, the temperature read is short
+  device.shortReads = 1;
+  CHECK(!shared.refresh());
+  device.skipReads = 1;  // Time read succeeds, the temperature read returns nothing
+  device.failReads = 1;
+  CHECK(!shared.refresh());
+  device.reg[DS3231M_RTCDATE] = 0x32;  // Not a valid date
+  CHECK(!shared.refresh());
+  uint32_t unixTime;
+  uint16_t milliseconds;
+  int32_t  temperature;
+  CHECK(shared.read(unixTime, milliseconds, temperature));
+  CHECK_EQUAL(BASE, unixTime);  // Less than a second of bus time has passed
+  CHECK_EQUAL(2025, temperature);
+}  // of function checkFailures()
+static void checkPhase() {
+  /*!
+   @brief     with the time base of the RTC active the milliseconds are the phase of the RTC second
+  */
+  DS3231M_Sim        device;
+  DS3231M_Class      rtc(device);
+  DS3231M_SharedTime shared(rtc);
+  rtc.begin();
+  rtc.timeBase(60000);
+  uint64_t start = hostMicros();
+  device.setTime(BASE);  // The second starts now
+  hostAdvance(600000);
+  CHECK(shared.refresh());  // Anchors the time base at the start of BASE + 1
+  hostAdvance(250000);
+  uint32_t unixTime;
+  uint16_t milliseconds;
+  int32_t  temperature;
+  CHECK(shared.read(unixTime, milliseconds, temperature));
+  uint32_t phase = (hostMicros() - start) % 1000000 / 1000;  // Truth, about 250ms
+  CHECK_EQUAL(device.time(), unixTime);
+  CHECK(milliseconds + 1u >= phase && milliseconds <= phase + 1);
+}  // of function checkPhase()
+int main() {
+  checkFailures();
+  checkPhase();
+  DS3231M_Sim        device;
+  DS3231M_Class      rtc(device);
+  DS3231M_SharedTime shared(rtc);
+  CHECK(rtc.begin());
+  unsigned long writeErrors = 0, reads[READERS] = {}, errors[READERS] = {};
+  auto          start = std::chrono::steady_clock::now();
+  std::vector<std::thread> threads;
+  for (uint8_t i = 0; i < READERS; ++i) {
+    threads.emplace_back(reader, &shared, &reads[i], &errors[i]);
+  }  // for-next each reader
+  threads.emplace_back(writer, &device, &shared, &writeErrors);
+  for (std::thread& thread : threads) {
+    thread.join();
+  }  // for-next each thread
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  unsigned long total = 0, bad = 0;
+  for (uint8_t i = 0; i < READERS; ++i) {
+    total += reads[i];
+    bad += errors[i];
+  }  // for-next each reader
+  CHECK_EQUAL(0, writeErrors);
+  CHECK_EQUAL(0, bad);
+  CHECK(total > 0);
+  uint32_t unixTime;
+  uint16_t milliseconds;
+  int32_t  temperature;
+  CHECK(shared.read(unixTime, milliseconds, temperature));
+  CHECK_EQUAL(BASE + (REFRESHES - 1) * 1000, unixTime);
+  CHECK_EQUAL(temperatureOf(REFRESHES - 1), temperature);
+  printf("  %u refreshes, %lu reads by %u threads in %.2fs, %.1f million reads/s, %lu retries\n",
+         REFRESHES, total, READERS, seconds, total / seconds / 1e6,
+         (unsigned long)shared.retries());
+  return hostTestResult("test_sharedtime");
+}  // of function main()
@@ -0,0 +1,116 @@
+/*!
+ @file test_timezone.cpp
+ @section test_timezone_intro_section Description
+ Host checks of DS3231M_TimeZone. The transitions of 2024 are compared with fixed UTC times and
+ the offsets of 2000 to 2099 with the C library localtime() using the equivalent POSIX "TZ"
+ strings, which glibc evaluates without any tzdata files
+*/
+#include <stdlib.h>
+#include <time.h>
+
+#include <initializer_list>
+
+#include "DS3231M.h"
+#include "HostTest.h"
+
+/*!
+ @brief    Zone of the library and the equivalent POSIX "TZ" string
+*/
+struct ZoneCase {
+  const DS3231M_Zone* zone;   ///< Library zone rule
+  const char*         posix;  ///< POSIX "TZ" string
+};                            // of struct ZoneCase
+static const ZoneCase ZONES[] = {
+    {&DS3231M_ZONE_UTC, "UTC0"},
+    {&DS3231M_ZONE_LONDON, "GMT0BST,M3.5.0/1,M10.5.0"},
+    {&DS3231M_ZONE_BERLIN, "CET-1CEST,M3.5.0,M10.5.0/3"},
+    {&DS3231M_ZONE_NEW_YORK, "EST5EDT,M3.2.0,M11.1.0"},
+    {&DS3231M_ZONE_CHICAGO, "CST6CDT,M3.2.0,M11.1.0"},
+    {&DS3231M_ZONE_DENVER, "MST7MDT,M3.2.0,M11.1.0"},
+    {&DS3231M_ZONE_LOS_ANGELES, "PST8PDT,M3.2.0,M11.1.0"},
+    {&DS3231M_ZONE_SYDNEY, "AEST-10AEDT,M10.1.0,M4.1.0/3"},
+    {&DS3231M_ZONE_KOLKATA, "IST-5:30"},
+    {&DS3231M_ZONE_TOKYO, "JST-9"}};
+
+static void checkTransition(const DS3231M_Zone* zone, const uint32_t utc, const int16_t before,
+                            const int16_t after) {
+  /*!
+   @brief     checks the offsets on both sides of a transition
+   @param[in] zone Zone rule
+   @param[in] utc UNIX time of the transition
+   @param[in] before Offset in minutes in the last second before it
+   @param[in] after Offset in minutes from the transition on
+  */
+  DS3231M_TimeZone tz(zone);
+  CHECK_EQUAL(before, tz.offset(utc - 1));
+  CHECK_EQUAL(after, tz.offset(utc));
+  CHECK_EQUAL(before, tz.offset(utc - 1));  // Same year cached, going backwards
+}  // of function checkTransition()
+static void checkKnown() {
+  /*!
+   @brief     the 2024 transitions and the fixed offset zones
+  */
+  checkTransition(&DS3231M_ZONE_BERLIN, DateTime(2024, 3, 31, 1).unixtime(), 60, 120);
+  checkTransition(&DS3231M_ZONE_BERLIN, DateTime(2024, 10, 27, 1).unixtime(), 120, 60);
+  checkTransition(&DS3231M_ZONE_LONDON, DateTime(2024, 3, 31, 1).unixtime(), 0, 60);
+  checkTransition(&DS3231M_ZONE_LONDON, DateTime(2024, 10, 27, 1).unixtime(), 60, 0);
+  checkTransition(&DS3231M_ZONE_NEW_YORK, DateTime(2024, 3, 10, 7).unixtime(), -300, -240);
+  checkTransition(&DS3231M_ZONE_NEW_YORK, DateTime(2024, 11, 3, 6).unixtime(), -240, -300);
+  checkTransition(&DS3231M_ZONE_SYDNEY, DateTime(2024, 4, 6, 16).unixtime(), 660, 600);
+  checkTransition(&DS3231M_ZONE_SYDNEY, DateTime(2024, 10, 5, 16).unixtime(), 600, 660);
+  DS3231M_TimeZone tz(&DS3231M_ZONE_KOLKATA);
+  CHECK_EQUAL(330, tz.offset(DateTime(2024, 7, 1).unixtime()));
+  CHECK(!tz.isDst(DateTime(2024, 7, 1).unixtime()));
+  tz.zone(&DS3231M_ZONE_TOKYO);
+  CHECK_EQUAL(540, tz.offset(DateTime(2024, 1, 1).unixtime()));
+  CHECK(tz.toLocal(DateTime(2024, 12, 31, 15)).unixtime() == DateTime(2025, 1, 1).unixtime());
+}  // of function checkKnown()
+static void checkToUtc() {
+  /*!
+   @brief     toUtc() reverses toLocal(), the repeated hour is standard time and the skipped hour
+              is moved back
+  */
+  DS3231M_TimeZone tz(&DS3231M_ZONE_BERLIN);
+  const uint32_t   end = DateTime(2024, 10, 27, 1).unixtime();  // First 02:00-03:00 is CEST
+  unsigned long    bad = 0;
+  for (uint32_t t = DateTime(2024, 1, 1).unixtime(); t < DateTime(2025, 1, 1).unixtime();
+       t += 900) {
+    bool repeated = t >= end - 3600 && t < end;
+    bad += tz.toUtc(tz.toLocal(t)) != (repeated ? t + 3600 : t);
+  }  // for-next each quarter hour
+  CHECK_EQUAL(0, bad);
+  CHECK(tz.toUtc(DateTime(2024, 10, 27, 2, 30)).unixtime() ==
+        DateTime(2024, 10, 27, 1, 30).unixtime());  // Repeated hour is taken as standard time
+  CHECK(tz.toUtc(DateTime(2024, 3, 31, 2, 30)).unixtime() ==
+        DateTime(2024, 3, 31, 0, 30).unixtime());  // Skipped hour is moved back
+}  // of function checkToUtc()
+static void checkLibrary() {
+  /*!
+   @brief     the offsets of all zones from 2000 to 2099 against localtime()
+  */
+  for (const ZoneCase& zone : ZONES) {
+    setenv("TZ", zone.posix, 1);
+    tzset();
+    DS3231M_TimeZone tz(zone.zone);
+    unsigned long    bad = 0;
+    for (uint32_t t = SECONDS_FROM_1970_TO_2000; t < 4102444800UL - 3600; t += 7 * 3600 + 780) {
+      for (uint32_t utc : {t, t + 3599}) {
+        time_t    value = utc;
+        struct tm tm;
+        localtime_r(&value, &tm);
+        bad += tz.offset(utc) * 60L != tm.tm_gmtoff || tz.isDst(utc) != (tm.tm_isdst > 0);
+      }  // for-next both ends of the hour
+    }    // for-next each sample
+    if (bad) {
+      Serial.print(F("  zone "));
+      Serial.println(zone.posix);
+    }  // if-then show the failing zone
+    CHECK_EQUAL(0, bad);
+  }  // for-next each zone
+}  // of function checkLibrary()
+int main() {
+  checkKnown();
+  checkToUtc();
+  checkLibrary();
+  return hostTestResult("test_timezone");
+}  // of function main()
@@ -5,52 +5,6 @@
  See main library header file for details
 */
 #include "DS3231M.h"  // Include the header definition
-const uint8_t daysInMonth[] PROGMEM = {31, 28, 31, 30, 31, 30,
-                                       31, 31, 30, 31, 30, 31};  ///< Numbers of days in each month
-
-static uint16_t date2days(uint16_t y, uint8_t m, uint8_t d) {
-  /*!
-   @brief     returns the number of days from a given Y M D value
-   @param[in] y Years
-   @param[in] m Months
-   @param[in] d Days
-   @return    Number of days from a given Y/M/D value
-  */
-  if (y >= 2000) {
-    y -= 2000;        // Remove year offset
-  }                   // if-then year is past 2000
-  uint16_t days = d;  // Store numbers of days
-  for (uint8_t i = 1; i < m; ++i) {
-    days += pgm_read_byte(daysInMonth + i - 1);  // Add number of days for each month
-  }                                              // for-next each month
-  if (m > 2 && (((y % 4 == 0) && (y % 100 != 0)) || (y % 400 == 0))) {
-    ++days;                                 // Deal with leap years
-  }                                         // if-then leap year
-  return days + 365 * y + (y + 3) / 4 - 1;  // Return computed value
-}  // of method date2days
-static long time2long(uint16_t days, uint8_t h, uint8_t m, uint8_t s) {
-  /*!
-   @brief     returns the number of seconds from a given D H M S value
-   @param[in] d Days
-   @param[in] h Hours
-   @param[in] m Minutes
-   @param[in] s Seconds
-   @return    Number of seconds from a given Day/Hour/Minute/Second value
-  */
-  return ((days * 24L + h) * 60 + m) * 60 + s;
-}  // of method time2long()
-static uint8_t conv2d(const char* p) {
-  /*!
-   @brief     converts character string representation to decimal
-   @param[in] p Input character array with length of 2 bytes
-   @return    Integer representation of value in array
-  */
-  uint8_t v = 0;
-  if ('0' <= *p && *p <= '9') {
-    v = *p - '0';              // set to integer value
-  }                            // if-then character is in range
-  return 10 * v + *++p - '0';  // shift MSB character over left and add 2nd character
-}  // of method conv2d
 DateTime::DateTime(uint32_t t) {
   /*!
    @brief   Class Constructor (Overloaded)
@@ -60,89 +14,76 @@ DateTime::DateTime(uint32_t t) {
             http://en.wikipedia.org/wiki/Leap_second for details
    @param[in] t Input time in seconds
   */
-  t -= SECONDS_FROM_1970_TO_2000;  // bring to 2000 timestamp from 1970
-  ss = t % 60;
-  t /= 60;
-  mm = t % 60;
-  t /= 60;
-  hh            = t % 24;
-  uint16_t days = t / 24;
-  uint8_t  leap;
-  for (yOff = 0;; ++yOff) {
-    leap = yOff % 4 == 0;
-    if (days < (uint16_t)365 + leap) { break; }  // if-then not a leap
-    days -= 365 + leap;
-  }  // of for-next each year
-  for (m = 1;; ++m) {
-    uint8_t daysPerMonth = pgm_read_byte(daysInMonth + m - 1);
-    if (leap && m == 2) { ++daysPerMonth; }  // if-then
-    if (days < daysPerMonth) { break; }      // if-then not a leap
-    days -= daysPerMonth;
-  }  // of for-next each month
-  d = days + 1;
-}  // of method DateTime()
-DateTime::DateTime(uint16_t year, uint8_t month, uint8_t day, uint8_t hour, uint8_t min,
-                   uint8_t sec) {
-  /*!
-   @brief     Class Constructor (Overloaded)
-   @details   Class Constructor for DateTime instantiates the class. This is an overloaded class
-              constructor so there are multiple definitions. This implementation ignores time zones
-              and DST changes. It also ignores leapseconds, see
-              http://en.wikipedia.org/wiki/Leap_second for details
-   @param[in] year Year
-   @param[in] month Month
-   @param[in] day Day
-   @param[in] hour Hour
-   @param[in] min Minute
-   @param[in] sec Second
-
-  */
-  if (year >= 2000) { year -= 2000; }  // if-then year past 2000
-  yOff = year;
-  m    = month;
-  d    = day;
-  hh   = hour;
-  mm   = min;
-  ss   = sec;
-}  // of method DateTime()
-/*!
- @brief     Class Constructor (Overloaded)
- @details   Class Constructor for DateTime instantiates the class. This is an overloaded class
-            constructor so there are multiple definitions. This implementation ignores time zones
-            and DST changes. It also ignores leapseconds, see
-            http://en.wikipedia.org/wiki/Leap_second for details
- @param[in] copy DateTime class to instantiate class with
-*/
-DateTime::DateTime(const DateTime& copy)
-    : yOff(copy.yOff), m(copy.m), d(copy.d), hh(copy.hh), mm(copy.mm), ss(copy.ss) {}
-DateTime::DateTime(const char* date, const char* time) {
-  /*!
-   @brief     Class Constructor (Overloaded)
-   @details   Class Constructor for DateTime instantiates the class. This is an overloaded class
-              constructor so there are multiple definitions. This implementation ignores time zones
-              and DST changes. It also ignores leapseconds, see
-              http://en.wikipedia.org/wiki/Leap_second for details. This version uses a string
-              representation of the date and time to instantiate. The date and time arrive in string
-              format as follows: date = "Dec 26 2009", time = "12:34:56"
-   @param[in] date Character buffer with year value in MMM DD YYYY format
-   @param[in] time Character buffer with time value in HH:MM:SS format
-  */
-  yOff = conv2d(date + 9);  // Compute the year offset
-  switch (date[0]) {
-    case 'J': m = (date[1] == 'a') ? 1 : ((date[2] == 'n') ? 6 : 7); break;  // Jan Jun Jul
-    case 'F': m = 2; break;                                                  // Feb
-    case 'A': m = date[2] == 'r' ? 4 : 8; break;                             // Apr Aug
-    case 'M': m = date[2] == 'r' ? 3 : 5; break;                             // May
-    case 'S': m = 9; break;                                                  // Sep
-    case 'O': m = 10; break;                                                 // Oct
-    case 'N': m = 11; break;                                                 // Nov
-    case 'D': m = 12; break;                                                 // Dec
-  }  // of switch for the month
-  d  = conv2d(date + 4);
-  hh = conv2d(time);
-  mm = conv2d(time + 3);
-  ss = conv2d(time + 6);
+  t -= SECONDS_FROM_1970_TO_2000;                    // bring to 2000 timestamp from 1970
+  uint16_t days    = t / SECONDS_PER_DAY;            // The only 32-bit division
+  uint32_t seconds = t - days * SECONDS_PER_DAY;     // Seconds in the day
+  uint16_t minutes = (uint16_t)(seconds >> 2) / 15;  // Divide by 60 in 16 bits
+  ss               = seconds - minutes * 60;
+  hh               = minutes / 60;
+  mm               = minutes - hh * 60;
+  uint8_t cycles   = days / 1461;  // 4-year cycles, each starting with a leap year
+  days -= cycles * 1461;           // Days into the 4-year cycle
+  yOff         = cycles * 4;
+  uint8_t leap = days < 366;  // The first year of each cycle is a leap year
+  if (!leap) {
+    uint8_t years = (days - 1) / 365;  // Years after the leap year
+    yOff += years;
+    days -= years * 365 + 1;
+  }  // if-then not the leap year
+  if (leap && days >= 59) {
+    if (days == 59) {  // Special case for February 29th
+      m = 2;
+      d = 29;
+      return;
+    }                 // if-then leap day
+    --days;           // Remove the leap day
+  }                   // if-then after leap day
+  m = days / 32 + 1;  // Estimated month is either correct or one too small
+  if (days >= daysBeforeMonth(m + 1)) {
+    ++m;
+  }  // if-then estimate one month too small
+  d = days - daysBeforeMonth(m) + 1;
 }  // of method DateTime()
+void PackedDateTime::toRegisters(uint8_t* frame) const {
+  /*!
+   @brief     unpacks into the 7 BCD time registers RTCSEC to RTCYEAR, e.g. to write to the RTC
+   @param[out] frame Buffer for the 7 register values
+  */
+  DateTime dt = dateTime();
+  uint8_t  fields[7] = {dt.second(),       dt.minute(), dt.hour(),        dt.dayOfTheWeek(),
+                        dt.day(),          dt.month(),  (uint8_t)(dt.year() - 2000)};
+  for (uint8_t i = 0; i < 7; ++i) {
+    frame[i] = ((fields[i] / 10) << 4) | (fields[i] % 10);  // Binary to BCD
+  }                                                         // for-next each register
+}  // of method toRegisters()
+DateTime PackedDateTime::dateTime() const {
+  /*!
+   @brief     unpacks into a DateTime
+   @return    DateTime value
+  */
+  return DateTime(unixtime());
+}  // of method dateTime()
+uint16_t PackedDateTime::year() const {
+  /*!
+   @brief     returns the year, decoded on request
+   @return    Year
+  */
+  return dateTime().year();
+}  // of method year()
+uint8_t PackedDateTime::month() const {
+  /*!
+   @brief     returns the month, decoded on request
+   @return    Month
+  */
+  return dateTime().month();
+}  // of method month()
+uint8_t PackedDateTime::day() const {
+  /*!
+   @brief     returns the day of the month, decoded on request
+   @return    Day
+  */
+  return dateTime().day();
+}  // of method day()
 DateTime::DateTime(const __FlashStringHelper* date, const __FlashStringHelper* time) {
   /*!
    brief     Class Constructor (Overloaded)
@@ -161,53 +102,91 @@ DateTime::DateTime(const __FlashStringHelper* date, const __FlashStringHelper* t
   yOff = a.yOff, m = a.m, d = a.d, hh = a.hh, mm = a.mm,
   ss = a.ss;  // copy temporary data to this object
 }  // of method DateTime()
-uint8_t DateTime::dayOfTheWeek() const {
-  /*!
-   @brief   Return the day-of-week
-   @details Monday = 1, Sunday = 7
-   @return  DOW with Monday-Sunday 1-7
-  */
-  uint16_t day = date2days(yOff, m, d);  // compute the number of days
-  return ((day + 5) % 7) + 1;            // Jan 1, 2000 is a Saturday, i.e. 6, Issue #22a
-}  // of method dayOfTheWeek()
-uint32_t DateTime::unixtime(void) const {
-  /*!
-   @brief   return the UNIX time, which is seconds since 1970-01-01 00:00:00
-   @return  UNIX Time (seconds since 1970-01-01 00:00:00)
-  */
-  uint32_t t;                                   // Declare return variable
-  uint16_t days = date2days(yOff, m, d);        // Compute days
-  t             = time2long(days, hh, mm, ss);  // Compute seconds
-  t += SECONDS_FROM_1970_TO_2000;               // Add seconds from 1970 to 2000
-  return t;
-}  // of method unixtime()
-long DateTime::secondstime(void) const {
-  /*!
-   @brief   return the time in seconds since 2000-01-01 00:00:00
-   @return  Seconds since 2000-01-01 00:00:00
-  */
-  long     t;
-  uint16_t days = date2days(yOff, m, d);
-  t             = time2long(days, hh, mm, ss);
-  return t;
-}  // of method secondstime()
-DateTime DateTime::operator+(const TimeSpan& span) {
+bool DateTime::step(const int32_t seconds) {
+  /*!
+   @brief     adds seconds by carrying into the time and day fields
+   @details   Used by the operators for spans of less than a day when the result stays within the
+              same month, which covers stepping timestamps by seconds, minutes or hours. The
+              fields are left unchanged when the result would be in another month or the fields are
+              not a valid date/time from 2000 to 2099, the caller then does the full conversion
+              through unixtime()
+   @param[in] seconds Seconds to add, -86399 to 86399
+   @return    true if the fields were updated
+  */
+  uint8_t length = daysInMonth(yOff, m);
+  if (yOff > 99 || m < 1 || m > 12 || d < 1 || d > length || hh > 23 || mm > 59 || ss > 59) {
+    return false;
+  }  // if-then not a valid date/time
+  int32_t daySecond = ((int32_t)(hh * 60 + mm)) * 60 + ss + seconds;
+  uint8_t day       = d;
+  if (daySecond < 0) {
+    if (day == 1) {
+      return false;
+    }  // if-then into the previous month
+    --day;
+    daySecond += SECONDS_PER_DAY;
+  } else if (daySecond >= (int32_t)SECONDS_PER_DAY) {
+    if (day == length) {
+      return false;
+    }  // if-then into the next month
+    ++day;
+    daySecond -= SECONDS_PER_DAY;
+  }                                                          // if-then-else carry into the day
+  uint16_t minutes = (uint16_t)((uint32_t)daySecond >> 2) / 15;  // Divide by 60 in 16 bits
+  ss               = daySecond - minutes * 60;
+  hh               = minutes / 60;
+  mm               = minutes - hh * 60;
+  d                = day;
+  return true;
+}  // of method step()
+DateTime& DateTime::operator+=(const TimeSpan& span) {
+  /*!
+   @brief     Overloaded in-place addition function definition
+   @details   Spans of less than a day that stay within the month are carried into the fields,
+              otherwise the result is converted from the UNIX time. Both give identical results
+   @param[in] span TimeSpan to add
+   @return    this DateTime
+  */
+  int32_t seconds = span.totalseconds();
+  if (seconds <= -(int32_t)SECONDS_PER_DAY || seconds >= (int32_t)SECONDS_PER_DAY ||
+      !step(seconds)) {
+    *this = DateTime(unixtime() + seconds);
+  }  // if-then full conversion needed
+  return *this;
+}  // of overloaded += function
+DateTime& DateTime::operator-=(const TimeSpan& span) {
+  /*!
+   @brief     Overloaded in-place subtraction function definition
+   @details   See operator+=()
+   @param[in] span TimeSpan to subtract
+   @return    this DateTime
+  */
+  int32_t seconds = span.totalseconds();
+  if (seconds <= -(int32_t)SECONDS_PER_DAY || seconds >= (int32_t)SECONDS_PER_DAY ||
+      !step(-seconds)) {
+    *this = DateTime(unixtime() - seconds);
+  }  // if-then full conversion needed
+  return *this;
+}  // of overloaded -= function
+DateTime DateTime::operator+(const TimeSpan& span) const {
   /*!
    @brief     Overloaded addition function definition
    @param[in] span TimeSpan to add
    @return    new DateTime value
   */
-  return DateTime(unixtime() + span.totalseconds());
+  DateTime result(*this);
+  return result += span;
 }  // of overloaded + function
-DateTime DateTime::operator-(const TimeSpan& span) {
+DateTime DateTime::operator-(const TimeSpan& span) const {
   /*!
    @brief     Overloaded subtraction function definition
    @param[in] span TimeSpan to subtract
    @return    new DateTime value
   */
-  return DateTime(unixtime() - span.totalseconds());
+  DateTime result(*this);
+  return result -= span;
 }  // of overloaded - function
-TimeSpan DateTime::operator-(const DateTime& right) {
+TimeSpan DateTime::operator-(const DateTime& right) const {
   /*!
    @brief     Overloaded subtraction function definition
    @param[in] right DateTime to subtract
@@ -215,42 +194,183 @@ TimeSpan DateTime::operator-(const DateTime& right) {
   */
   return TimeSpan(unixtime() - right.unixtime());
 }  // of overloaded - function
-/*!
- @brief     TimeSpan class constructor (Overloaded)
- @param[in] seconds Number of seconds
-*/
-TimeSpan::TimeSpan(int32_t seconds) : _seconds(seconds) {}
-/*!
- @brief     TimeSpan class constructor (Overloaded)
- @param[in] days Number of Days
- @param[in] hours Number of Hours
- @param[in] minutes Number of Minutes
- @param[in] seconds Number of Seconds
-*/
-TimeSpan::TimeSpan(int16_t days, int8_t hours, int8_t minutes, int8_t seconds)
-    : _seconds((int32_t)days * 86400L + (int32_t)hours * 3600 + (int32_t)minutes * 60 + seconds) {}
-/*!
- @brief     TimeSpan class constructor (Overloaded)
- @param[in] copy TimeSpan to use to instantiate class
-*/
-TimeSpan::TimeSpan(const TimeSpan& copy) : _seconds(copy._seconds) {}
-TimeSpan TimeSpan::operator+(const TimeSpan& right) {
+void DateTime::convertUnixtime(const uint32_t* __restrict__ unixTimes, const size_t count,
+                               uint16_t* __restrict__ years, uint8_t* __restrict__ months,
+                               uint8_t* __restrict__ days, uint8_t* __restrict__ hours,
+                               uint8_t* __restrict__ minutes, uint8_t* __restrict__ seconds) {
+  /*!
+   @brief     converts an array of UNIX times into separate arrays of date/time fields
+   @details   The results are identical to constructing a DateTime from each value. The loop body
+              has no branches or table lookups and the arrays must not overlap, so that compilers
+              can vectorize it. Days are counted from 1996-03-01 so that each 4-year cycle ends with
+              the leap day
+   @param[in] unixTimes Array of UNIX times
+   @param[in] count Number of values to convert
+   @param[out] years Array of years
+   @param[out] months Array of months
+   @param[out] days Array of days
+   @param[out] hours Array of hours
+   @param[out] minutes Array of minutes
+   @param[out] seconds Array of seconds
+  */
+  for (size_t i = 0; i < count; ++i) {
+    uint32_t t         = unixTimes[i] - SECONDS_FROM_1970_TO_2000;
+    uint32_t dayNumber = t / SECONDS_PER_DAY;
+    uint32_t daySecond = t - dayNumber * SECONDS_PER_DAY;
+    uint32_t dayMinute = daySecond / 60;
+    uint32_t hour      = dayMinute / 60;
+    seconds[i]         = daySecond - dayMinute * 60;
+    minutes[i]         = dayMinute - hour * 60;
+    hours[i]           = hour;
+    uint32_t z         = dayNumber + 1401;          // Days since 1996-03-01
+    uint32_t cycle     = z / 1461;                  // 4-year cycle
+    uint32_t doc       = z - cycle * 1461;          // Day of cycle
+    uint32_t yoc       = (doc - doc / 1460) / 365;  // Year of cycle
+    uint32_t doy       = doc - 365 * yoc;           // Day of March-based year
+    uint32_t mp        = (5 * doy + 2) / 153;       // March-based month
+    days[i]            = doy - (153 * mp + 2) / 5 + 1;
+    months[i]          = mp < 10 ? mp + 3 : mp - 9;
+    years[i]           = 1996 + 4 * cycle + yoc + (mp >= 10);
+  }  // of for-next each value
+}  // of method convertUnixtime()
+void DateTime::convertFields(const uint16_t* years, const uint8_t* months, const uint8_t* days,
+                             const uint8_t* hours, const uint8_t* minutes, const uint8_t* seconds,
+                             const size_t count, uint32_t* unixTimes) {
+  /*!
+   @brief     converts separate arrays of date/time fields into an array of UNIX times
+   @details   The results are identical to calling unixtime() on a DateTime built from each set of
+              fields. The loop body has no branches or table lookups so that compilers can vectorize
+              it
+   @param[in] years Array of years
+   @param[in] months Array of months
+   @param[in] days Array of days
+   @param[in] hours Array of hours
+   @param[in] minutes Array of minutes
+   @param[in] seconds Array of seconds
+   @param[in] count Number of values to convert
+   @param[out] unixTimes Array of UNIX times
+  */
+  for (size_t i = 0; i < count; ++i) {
+    uint32_t y  = years[i] - 1996 - (months[i] <= 2);                 // March-based years
+    uint32_t mp = months[i] > 2 ? months[i] - 3 : months[i] + 9;      // March-based month
+    uint32_t dayNumber = 365 * y + y / 4 + (153 * mp + 2) / 5 + days[i] - 1402;  // Since 2000
+    uint32_t t         = ((dayNumber * 24 + hours[i]) * 60 + minutes[i]) * 60 + seconds[i];
+    unixTimes[i]       = t + SECONDS_FROM_1970_TO_2000;
+  }  // of for-next each value
+}  // of method convertFields()
+void DateTime::daysOfTheWeek(const uint32_t* unixTimes, const size_t count, uint8_t* weekdays) {
+  /*!
+   @brief     computes the day-of-week for an array of UNIX times
+   @details   Monday = 1, Sunday = 7, identical to dayOfTheWeek()
+   @param[in] unixTimes Array of UNIX times
+   @param[in] count Number of values
+   @param[out] weekdays Array of days-of-week
+  */
+  for (size_t i = 0; i < count; ++i) {
+    uint32_t dayNumber = (unixTimes[i] - SECONDS_FROM_1970_TO_2000) / SECONDS_PER_DAY;
+    weekdays[i]        = (dayNumber + 5) % 7 + 1;  // Jan 1, 2000 is a Saturday
+  }                                                // of for-next each value
+}  // of method daysOfTheWeek()
+/*! @brief Two ASCII digits for each value 0-99, used by toString() */
+static const char dateTimeDigits[] PROGMEM =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+/*! @brief Separators after the year, month, day, hour and minute for each dateTimeFormats value,
+           a 0 means that the fields follow each other directly */
+static const char dateTimeSeparators[][5] PROGMEM = {
+    {'-', '-', 'T', ':', ':'}, {'-', '-', ' ', ':', ':'}, {0, 0, 'T', 0, 0}};
+uint8_t DateTime::toString(char* buffer, const uint8_t size, const dateTimeFormats format) const {
   /*!
-   @brief     TimeSpan class addition (Overloaded)
-   @param[in] right TimeSpan to use to add to value
-   @return    Sum of two TimeSpans
+   @brief     writes the date/time as text into a caller-provided buffer
+   @details   Each field is copied as two digits from a table, so neither printf() nor any division
+              is used. The year is written as the century followed by the year offset. Fields
+              above 99, which are not a valid date/time, are written as 99
+   @param[out] buffer Buffer for the zero-terminated text
+   @param[in] size Size of the buffer, DS3231M_DATE_TIME_SIZE is enough for all formats
+   @param[in] format Text format, see dateTimeFormats
+   @return    Number of characters written without the terminator, 0 if the buffer is too small
   */
-  return TimeSpan(_seconds + right._seconds);
-}  // of overloaded add
-TimeSpan TimeSpan::operator-(const TimeSpan& right) {
+  const char* separators = dateTimeSeparators[format];
+  uint8_t     length     = 14;  // Seven 2-digit fields
+  for (uint8_t i = 0; i < 5; ++i) {
+    length += pgm_read_byte(&separators[i]) != 0;
+  }  // for-next each separator
+  if (size <= length) {
+    if (size) {
+      buffer[0] = 0;
+    }  // if-then buffer can hold the terminator
+    return 0;
+  }  // if-then buffer too small
+  uint8_t fields[7] = {(uint8_t)(20 + yOff / 100), (uint8_t)(yOff % 100), m, d, hh, mm, ss};
+  char*   p         = buffer;
+  for (uint8_t i = 0; i < 7; ++i) {
+    const char* digits = &dateTimeDigits[2 * (fields[i] > 99 ? 99 : fields[i])];  // In the table
+    *p++               = pgm_read_byte(digits);
+    *p++               = pgm_read_byte(digits + 1);
+    if (i >= 1 && i <= 5) {
+      char separator = pgm_read_byte(&separators[i - 1]);
+      if (separator) {
+        *p++ = separator;
+      }  // if-then format has a separator here
+    }    // if-then field can be followed by a separator
+  }      // for-next each field
+  *p = 0;
+  return length;
+}  // of method toString()
+parseResults DateTime::parse(const char* text, DateTime& result, const dateTimeFormats format) {
   /*!
-   @brief     TimeSpan class subtraction (Overloaded)
-   @param[in] right TimeSpan to use to subtract from value
-   @return    Difference value
+   @brief     reads a date/time in one of the toString() formats
+   @details   The date and time may be separated by "T", "t" or a space in isoFormat and
+              isoSpaceFormat. Text following the seconds is ignored as long as it does not start
+              with a digit, so a trailing "Z", carriage return or command terminator is accepted.
+              Only years 2000-2099 are supported
+   @param[in] text Zero-terminated text
+   @param[out] result Date/time read, only set when parseOk is returned
+   @param[in] format Text format, see dateTimeFormats
+   @return    parseOk, parseSyntax if the text does not match the format or parseRange if a field
+              is outside of its valid range
   */
-  return TimeSpan(_seconds - right._seconds);
-}  // of overloaded subtract
-DS3231M_Class::DS3231M_Class() {}   ///< Unused class constructor
+  const char* separators = dateTimeSeparators[format];
+  uint8_t     fields[7];  // Century, year, month, day, hour, minute and second
+  for (uint8_t i = 0; i < 7; ++i) {
+    uint8_t high = (uint8_t)text[0] - '0';  // Characters below '0' wrap around to large values
+    if (high > 9) {
+      return parseSyntax;
+    }  // if-then not a digit
+    uint8_t low = (uint8_t)text[1] - '0';
+    if (low > 9) {
+      return parseSyntax;
+    }  // if-then not a digit
+    fields[i] = high * 10 + low;
+    text += 2;
+    if (i >= 1 && i <= 5) {
+      char separator = pgm_read_byte(&separators[i - 1]);
+      if (separator) {
+        char c = *text;
+        if (c != separator && !(i == 3 && (c == ' ' || c == 'T' || c == 't'))) {
+          return parseSyntax;
+        }  // if-then wrong separator
+        ++text;
+      }  // if-then format has a separator here
+    }    // if-then field can be followed by a separator
+  }      // for-next each field
+  if ((uint8_t)(*text - '0') <= 9) {
+    return parseSyntax;
+  }  // if-then too many digits
+  if (fields[0] != 20 || fields[2] < 1 || fields[2] > 12 || fields[3] < 1 ||
+      fields[3] > daysInMonth(fields[1], fields[2]) || fields[4] > 23 || fields[5] > 59 ||
+      fields[6] > 59) {
+    return parseRange;
+  }  // if-then field out of range
+  result = DateTime(fields[1], fields[2], fields[3], fields[4], fields[5], fields[6]);
+  return parseOk;
+}  // of method parse()
+/*! @brief Default bus used by DS3231M_Class, the "Wire" object */
+static DS3231M_WireBus<decltype(Wire)> defaultBus(Wire);
+DS3231M_Class::DS3231M_Class() : _bus(&defaultBus), _address(DS3231M_ADDRESS) {}  ///< Constructor
+DS3231M_Class::DS3231M_Class(DS3231M_Bus& bus, const uint8_t address)
+    : _bus(&bus), _address(address) {}  ///< Class constructor for another bus or address
 DS3231M_Class::~DS3231M_Class() {}  ///< Unused class destructor
 bool DS3231M_Class::begin(const uint32_t i2cSpeed) {
   /*!
@@ -258,15 +378,12 @@ bool DS3231M_Class::begin(const uint32_t i2cSpeed) {
    @param[in] i2cSpeed I2C Speed to use for communications
    @return    Boolean status of the initialization
   */
-  Wire.begin();                                // Start I2C as master device
-  Wire.setClock(i2cSpeed);                     // Set I2C clock speed
-  Wire.beginTransmission(DS3231M_ADDRESS);     // Address the DS3231M
-  uint8_t errorCode = Wire.endTransmission();  // See if there's a device present
-  if (errorCode == 0)                          // If we have a DS3231M
+  _bus->begin(i2cSpeed);                                          // Start I2C as master device
+  uint8_t errorCode = _bus->write(_address, DS3231M_RTCSEC, nullptr, 0);  // See if it is present
+  if (errorCode == 0)                                             // If we have a DS3231M
   {
-    writeByte(DS3231M_RTCHOUR, readByte(DS3231M_RTCHOUR) &
-                                   B10111111);  // Force use of 24 hour clock by turning off bit
-  }                                             // of if-then device detected
+    update(DS3231M_HOUR_12(0));  // Force use of 24 hour clock
+  }                              // of if-then device detected
   else {
     return false;
   }
@@ -278,11 +395,9 @@ uint8_t DS3231M_Class::readByte(const uint8_t addr) {
    @param[in] addr Memory/Register address
    @return    byte read from specified address
   */
-  Wire.beginTransmission(DS3231M_ADDRESS);        // Address the I2C device
-  Wire.write(addr);                               // Send the register address to read
-  _TransmissionStatus = Wire.endTransmission();   // Close transmission
-  Wire.requestFrom(DS3231M_ADDRESS, (uint8_t)1);  // Request 1 byte of data
-  return Wire.read();                             // read it and return it
+  uint8_t data = 0;           // Return 0 if the read fails
+  readBytes(addr, &data, 1);  // Single byte burst read
+  return data;
 }  // of method readByte()
 void DS3231M_Class::writeByte(const uint8_t addr, const uint8_t data) {
   /*!
@@ -290,11 +405,182 @@ void DS3231M_Class::writeByte(const uint8_t addr, const uint8_t data) {
    @param[in] addr Memory/Register address
    @param[in] data Byte to write
   */
-  Wire.beginTransmission(DS3231M_ADDRESS);       // Address the I2C device
-  Wire.write(addr);                              // Send the register address to write
-  Wire.write(data);                              // Send the data to write
-  _TransmissionStatus = Wire.endTransmission();  // Close transmission
+  writeBytes(addr, &data, 1);  // Single byte burst write
 }  // of method writeByte()
+uint8_t DS3231M_Class::readBytes(const uint8_t addr, uint8_t* data, const uint8_t len) {
+  /*!
+   @brief     reads a number of consecutive registers in one I2C transaction
+   @details   The DS3231M auto-increments the register pointer, so a burst read returns a coherent
+              image of consecutive registers since the user buffers are latched at the start
+   @param[in] addr Starting Memory/Register address
+   @param[out] data Buffer to read the register values into
+   @param[in] len Number of bytes to read
+   @return    number of bytes actually read
+  */
+#if DS3231M_INSTRUMENTATION
+  uint32_t startMicros = micros();
+#endif
+  ++_readCount;                                                   // Count the read transaction
+  _TransmissionStatus = _bus->write(_address, addr, nullptr, 0);  // Send the register address
+  uint8_t bytesRead   = _bus->read(_address, data, len);          // Read "len" bytes of data
+#if DS3231M_INSTRUMENTATION
+  record(addr, false, len, bytesRead, startMicros);
+#endif
+  return bytesRead;
+}  // of method readBytes()
+void DS3231M_Class::writeBytes(const uint8_t addr, const uint8_t* data, const uint8_t len) {
+  /*!
+   @brief     writes a number of consecutive registers in one I2C transaction
+   @details   The written values go through to the register shadow copy. When the write fails the
+              device contents are unknown, so the shadow copy is invalidated instead
+   @param[in] addr Starting Memory/Register address
+   @param[in] data Buffer with the values to write
+   @param[in] len Number of bytes to write
+  */
+#if DS3231M_INSTRUMENTATION
+  uint32_t startMicros = micros();
+#endif
+  ++_writeCount;                                                 // Count the write transaction
+  _TransmissionStatus = _bus->write(_address, addr, data, len);  // Send address and data
+#if DS3231M_INSTRUMENTATION
+  record(addr, true, len, _TransmissionStatus ? 0 : len, startMicros);
+#endif
+  if (_TransmissionStatus != 0) {
+    _shadowValid = false;  // Read the registers from the device until the next refresh()
+    return;
+  }  // if-then write failed
+  for (uint8_t i = 0; i < len; ++i) {
+    uint8_t reg = addr + i;
+    if (reg >= DS3231M_ALM1SEC && reg <= DS3231M_AGING) {
+      _shadow[reg - DS3231M_ALM1SEC] = data[i];  // Write-through to the shadow copy
+    }                                            // if-then register is shadowed
+    if (reg == DS3231M_CONTROL) {
+      _shadow[reg - DS3231M_ALM1SEC] = DS3231M_CONV(0).apply(data[i]);  // CONV clears itself
+    }  // if-then CONTROL register
+  }                                           // of for-next each byte
+}  // of method writeBytes()
+uint8_t DS3231M_Class::readRegister(const uint8_t addr) {
+  /*!
+   @brief     reads a configuration register, using the shadow copy when it is valid
+   @details   The volatile STATUS flags (OSF, BSY, A1F, A2F) are never served from the shadow copy,
+              so STATUS is always read from the device
+   @param[in] addr Memory/Register address
+   @return    register value
+  */
+  uint8_t value = 0;  // Return 0 if the read fails
+  readRegister(addr, value);
+  return value;
+}  // of method readRegister()
+bool DS3231M_Class::readRegister(const uint8_t addr, uint8_t& value) {
+  /*!
+   @brief     reads a configuration register, using the shadow copy when it is valid (Overloaded)
+   @details   This version reports whether the value could be read, see readRegister(addr)
+   @param[in] addr Memory/Register address
+   @param[out] value register value, only set when the read succeeds
+   @return    true if the value was taken from the shadow copy or read from the device
+  */
+  if (_shadowValid && addr >= DS3231M_ALM1SEC && addr <= DS3231M_AGING && addr != DS3231M_STATUS) {
+    value = _shadow[addr - DS3231M_ALM1SEC];  // Serve from the shadow copy
+    return true;
+  }  // if-then register is shadowed
+  uint8_t data;
+  if (readBytes(addr, &data, 1) != 1 || _TransmissionStatus != 0) {
+    return false;
+  }  // if-then read failed
+  value = data;
+  return true;
+}  // of method readRegister()
+uint8_t DS3231M_Class::writeValue(const DS3231M_Update& change, const uint8_t value) {
+  /*!
+   @brief     returns the value to write back to a register for a change
+   @details   Writing a 1 to the OSF, A1F or A2F flag leaves it unchanged, so the flags of STATUS
+              that are not part of the change are written as 1. A flag that is set by the device
+              between the read and the write is then kept instead of being cleared
+   @param[in] change Fields to change
+   @param[in] value Register value that was read
+   @return    Register value to write
+  */
+  const uint8_t flags = (DS3231M_OSF(1) | DS3231M_A2F(1) | DS3231M_A1F(1)).bits;
+  if (change.reg == DS3231M_STATUS) {
+    return change.apply(value) | (flags & ~change.mask);
+  }  // if-then STATUS register
+  return change.apply(value);
+}  // of method writeValue()
+void DS3231M_Class::update(const DS3231M_Update& change) {
+  /*!
+   @brief     changes one or more bit fields of a register
+   @details   The register is read (from the shadow copy when valid) and only written back if the
+              value changes. Nothing is written when the register could not be read
+   @param[in] change Fields to change, combined with "|"
+  */
+  uint8_t value;
+  if (!readRegister(change.reg, value)) {
+    return;  // Never write back a value that was not read
+  }          // if-then read failed
+  if (change.apply(value) != value) {
+    writeByte(change.reg, writeValue(change, value));
+  }  // if-then value changes
+}  // of method update()
+static_assert((DS3231M_INTCN(0) | DS3231M_RS(0)).mask == 0x1C, "Fields are coalesced");
+static_assert((DS3231M_A1F(0) | DS3231M_A2F(0)).reg == DS3231M_STATUS, "Same register");
+void DS3231M_Class::update(const DS3231M_Update& first, const DS3231M_Update& second) {
+  /*!
+   @brief     changes bit fields of 2 consecutive registers with one burst read and one burst write
+   @details   Used for CONTROL and STATUS, which are updated together when setting the clock or an
+              alarm. Nothing is written when the registers could not be read
+   @param[in] first Fields to change in the first register
+   @param[in] second Fields to change in the register following it
+  */
+  uint8_t buffer[2];
+  if (readBytes(first.reg, buffer, 2) != 2 || _TransmissionStatus != 0) {
+    return;  // Never write back values that were not read
+  }          // if-then read failed
+  if (first.apply(buffer[0]) != buffer[0] || second.apply(buffer[1]) != buffer[1]) {
+    uint8_t changed[2] = {writeValue(first, buffer[0]), writeValue(second, buffer[1])};
+    writeBytes(first.reg, changed, 2);
+  }  // if-then values change
+}  // of method update()
+bool DS3231M_Class::refresh() {
+  /*!
+   @brief     reads the alarm, CONTROL, STATUS and AGING registers into the shadow copy
+   @details   Once the shadow copy is valid all configuration changes are done with a single write
+              instead of a read-modify-write. The shadow stays valid until invalidate() is called
+   @return    true if the shadow copy was successfully loaded
+  */
+  _shadowValid = false;
+  uint8_t len  = DS3231M_AGING - DS3231M_ALM1SEC + 1;  // Number of shadowed registers
+  _shadowValid = (readBytes(DS3231M_ALM1SEC, _shadow, len) == len && _TransmissionStatus == 0);
+  uint8_t& control = _shadow[DS3231M_CONTROL - DS3231M_ALM1SEC];
+  control          = DS3231M_CONV(0).apply(control);  // CONV clears itself, never keep it set
+  return _shadowValid;
+}  // of method refresh()
+void DS3231M_Class::invalidate() {
+  /*!
+   @brief     discards the shadow copy so that all registers are read from the device again
+  */
+  _shadowValid = false;
+}  // of method invalidate()
+uint32_t DS3231M_Class::readCount() {
+  /*!
+   @brief     returns the number of I2C read transactions since the last resetCounters()
+   @return    number of read transactions
+  */
+  return _readCount;
+}  // of method readCount()
+uint32_t DS3231M_Class::writeCount() {
+  /*!
+   @brief     returns the number of I2C write transactions since the last resetCounters()
+   @return    number of write transactions
+  */
+  return _writeCount;
+}  // of method writeCount()
+void DS3231M_Class::resetCounters() {
+  /*!
+   @brief     resets the I2C transaction counters
+  */
+  _readCount  = 0;
+  _writeCount = 0;
+}  // of method resetCounters()
 uint8_t DS3231M_Class::bcd2int(const uint8_t bcd) {
   /*!
    @brief     converts a BCD encoded value into number representation
@@ -322,7 +608,8 @@ void DS3231M_Class::adjust() {
               set, but the oscillator is stopped during the process and needs to be restarted upon
               completion
   */
-  adjust(DateTime(F(__DATE__), F(__TIME__)));  // Set to compile time
+  constexpr DateTime compiled(__DATE__, __TIME__);  // Parsed by the compiler
+  adjust(compiled);                                 // Set to compile time
 }  // of method adjust
 void DS3231M_Class::adjust(const DateTime& dt) {
   /*!
@@ -333,154 +620,807 @@ void DS3231M_Class::adjust(const DateTime& dt) {
               completion
    @param[in] dt DateTime value to set the clock to
   */
-  writeByte(DS3231M_RTCSEC, int2bcd(dt.second() % 60));   // Write seconds, keep device off
-  writeByte(DS3231M_RTCMIN, int2bcd(dt.minute() % 60));   // Write the minutes value
-  writeByte(DS3231M_RTCHOUR, int2bcd(dt.hour() % 24));    // Also resets the 24Hour clock on
-  writeByte(DS3231M_RTCWKDAY, dt.dayOfTheWeek());         // Update the weekday
-  writeByte(DS3231M_RTCDATE, int2bcd(dt.day()));          // Write the day of month
-  writeByte(DS3231M_RTCMTH, int2bcd(dt.month()));         // Month, ignore century bit
-  writeByte(DS3231M_RTCYEAR, int2bcd(dt.year() - 2000));  // Write the year
-  writeByte(DS3231M_STATUS, readByte(DS3231M_STATUS) & B01111111);    // Unset OSC flag bit if set
-  writeByte(DS3231M_CONTROL, readByte(DS3231M_CONTROL) & B01111111);  // Unset EOSC flag bit if set
-  _SetUnixTime = now().unixtime();                                    // Store time of last change
+  uint8_t buffer[7];                       // Image of the RTCSEC..RTCYEAR registers
+  buffer[0] = int2bcd(dt.second() % 60);   // Seconds, also resets the countdown chain
+  buffer[1] = int2bcd(dt.minute() % 60);   // Minutes
+  buffer[2] = int2bcd(dt.hour() % 24);     // Hours, also resets the 24Hour clock on
+  buffer[3] = dt.dayOfTheWeek();           // Weekday
+  buffer[4] = int2bcd(dt.day());           // Day of month
+  buffer[5] = int2bcd(dt.month());         // Month, ignore century bit
+  buffer[6] = int2bcd(dt.year() - 2000);   // Year
+  writeBytes(DS3231M_RTCSEC, buffer, 7);   // Write all time registers in one burst
+  update(DS3231M_EOSC(0), DS3231M_OSF(0));  // Start the oscillator and clear the stop flag
+  _SetUnixTime = dt.unixtime();            // Store time of last change
+  _anchorValid = false;                    // Time base needs a new anchor
 }  // of method adjust
 DateTime DS3231M_Class::now() {
   /*!
    @brief     returns the current date/time
+   @details   When the time base is active (see timeBase()) the value is served from the local
+              time base and no I2C transaction is made unless the anchor needs refreshing
    @return    Current Date/Time
   */
-  Wire.beginTransmission(DS3231M_ADDRESS);        // Address the I2C device
-  Wire.write(DS3231M_RTCSEC);                     // Start at specified register
-  _TransmissionStatus = Wire.endTransmission();   // Close transmission
-  Wire.requestFrom(DS3231M_ADDRESS, (uint8_t)7);  // Request 7 bytes of data
-  if (Wire.available() == 7)                      // Wait until the data is ready
+  if (_timeBaseInterval == 0) {
+    return readClock();  // Read the device directly
+  }                      // if-then no time base
+  uint16_t milliseconds;
+  return now(milliseconds);
+}  // of method now()
+PackedDateTime DS3231M_Class::nowPacked() {
+  /*!
+   @brief     returns the current date/time packed into 4 bytes
+   @details   The time registers are read in one burst and packed directly, without decoding into
+              a DateTime first. The local time base is not used
+   @return    Current Date/Time, 2000-01-01 00:00:00 if the read failed
+  */
+  uint8_t buffer[7];
+  if (readBytes(DS3231M_RTCSEC, buffer, 7) != 7) {
+    return PackedDateTime();
+  }  // if-then read failed
+  return PackedDateTime::fromRegisters(buffer);
+}  // of method nowPacked()
+DateTime DS3231M_Class::now(uint16_t& milliseconds) {
+  /*!
+   @brief     returns the current date/time with the sub-second part (Overloaded)
+   @details   The time is interpolated from the last anchor read of the RTC using millis(). If
+              timeBaseEdge() is being called on every falling edge of the 1Hz INT/SQW signal then
+              seconds are counted by the edges and the milliseconds are measured from the last
+              edge, otherwise the milliseconds are measured from the anchor, which is taken at a
+              change of the seconds register. Without an active time base, or when the anchor
+              cannot be read, the device is read and the milliseconds are returned as 0
+   @param[out] milliseconds Milliseconds within the current second (0-999)
+   @return    Current Date/Time
+  */
+  DateTime dt;
+  if (!timeBaseRead(dt, milliseconds)) {
+    milliseconds = 0;
+    return readClock();  // No time base or no anchor, read the device directly
+  }                      // if-then time base not available
+  return dt;
+}  // of method now()
+bool DS3231M_Class::timeBaseRead(DateTime& dt, uint16_t& milliseconds) {
+  /*!
+   @brief     returns the current date/time and its sub-second part from the time base
+   @details   Same as now(milliseconds) but reports when the time base can't be used instead of
+              reading the device
+   @param[out] dt Current Date/Time, only set when the time base is used
+   @param[out] milliseconds Milliseconds within the current second (0-999), only set with dt
+   @return    false if the time base is not active or the anchor could not be read
+  */
+  if (_timeBaseInterval == 0) {
+    return false;
+  }  // if-then no time base
+  if (!_anchorValid || millis() - _anchorMillis >= _timeBaseInterval) {
+    if (!anchorTimeBase()) {
+      return false;
+    }              // if-then anchor read failed
+  }                // if-then anchor needs refreshing
+  noInterrupts();  // Copy the ISR-updated values atomically
+  uint32_t edgeCount  = _edgeCount;
+  uint32_t edgeMillis = _edgeMillis;
+  interrupts();
+  uint32_t current = millis();
+  uint32_t unixTime;
+  if (edgeCount != 0 && current - edgeMillis < DS3231M_EDGE_TIMEOUT) {
+    unixTime     = _anchorUnix + (edgeCount - _anchorEdge);
+    milliseconds = current - edgeMillis;
+    if (milliseconds > 999) {
+      milliseconds = 999;  // Clamp when an edge is slightly late
+    }                      // if-then edge overdue
+  } else {
+    uint32_t elapsed = current - _anchorMillis;  // Milliseconds since the anchor was read
+    unixTime         = _anchorUnix + elapsed / 1000;
+    milliseconds     = elapsed % 1000;
+  }  // if-then-else edges are being received
+  dt = DateTime(unixTime);
+  return true;
+}  // of method timeBaseRead()
+void DS3231M_Class::timeBase(const uint32_t interval) {
+  /*!
+   @brief     activates or deactivates the interpolated time base used by now()
+   @details   The RTC is anchored to millis() and now() is served from that anchor until it is
+              "interval" milliseconds old. Without the 1Hz edges of timeBaseEdge() the anchoring
+              reads the time until the seconds change, which takes up to 1 second. A value of 0
+              turns the time base off so that every now() call reads the device
+   @param[in] interval Milliseconds between re-anchoring reads of the RTC, 0 to deactivate
+  */
+  _timeBaseInterval = interval;
+  _anchorValid      = false;  // Force a new anchor read
+}  // of method timeBase()
+void DS3231M_Class::timeBaseEdge() {
+  /*!
+   @brief     records a falling edge of the 1Hz INT/SQW signal
+   @details   This is meant to be called from the interrupt routine attached to the INT/SQW pin
+              after pinSquareWave() has been called. The falling edge coincides with the increment
+              of the seconds register. It does no I2C traffic and is safe to call from an ISR
+  */
+  _edgeMillis = millis();
+  ++_edgeCount;
+}  // of method timeBaseEdge()
+uint32_t DS3231M_Class::timeBaseAge() {
+  /*!
+   @brief     returns the age of the time base anchor
+   @return    Milliseconds since the anchor was read from the RTC, 0xFFFFFFFF if there is no anchor
+  */
+  if (!_anchorValid) {
+    return 0xFFFFFFFF;
+  }  // if-then no anchor
+  return millis() - _anchorMillis;
+}  // of method timeBaseAge()
+uint16_t DS3231M_Class::timeBaseError() {
+  /*!
+   @brief     returns the upper bound of the error of the interpolated time
+   @details   The error is limited to the millis() resolution plus the MCU clock tolerance, which
+              applies over less than 1 second when synchronized to the 1Hz edges and otherwise over
+              the whole anchor age
+   @return    Maximum error in milliseconds, 0xFFFF if there is no anchor
+  */
+  if (!_anchorValid) {
+    return 0xFFFF;
+  }  // if-then no anchor
+  noInterrupts();  // Copy the ISR-updated values atomically
+  uint32_t edgeCount  = _edgeCount;
+  uint32_t edgeMillis = _edgeMillis;
+  interrupts();
+  uint32_t current = millis();
+  uint32_t error;
+  if (edgeCount != 0 && current - edgeMillis < DS3231M_EDGE_TIMEOUT) {
+    error = 1 + (current - edgeMillis) / (1000000UL / DS3231M_MCU_TOLERANCE_PPM);
+  } else {
+    error = 1 + (current - _anchorMillis) / (1000000UL / DS3231M_MCU_TOLERANCE_PPM);
+  }  // if-then-else edges are being received
+  return error > 0xFFFF ? 0xFFFF : error;
+}  // of method timeBaseError()
+bool DS3231M_Class::anchorTimeBase() {
+  /*!
+   @brief     reads the RTC and anchors the time base to millis() and the edge counter
+   @details   The time is read with readTime(), so a failed or implausible read never becomes the
+              anchor. When 1Hz edges are being received they give the sub-second phase, and if an
+              edge arrives during the read it is repeated once so that the time read and the edge
+              count belong to the same second. Otherwise the time registers are read until the
+              seconds change, taking up to 1 second, so that the anchor is at the start of a second
+              and a new anchor never moves the time backwards
+   @return    false if the RTC could not be read, the anchor is then invalid
+  */
+  _anchorValid = false;
+  noInterrupts();  // Copy the ISR-updated values atomically
+  uint32_t edgeCount  = _edgeCount;
+  uint32_t edgeMillis = _edgeMillis;
+  interrupts();
+  if (edgeCount == 0 || millis() - edgeMillis >= DS3231M_EDGE_TIMEOUT) {
+    DateTime anchor;
+    if (!readTime(anchor)) {
+      return false;
+    }  // if-then read failed
+    uint32_t first = anchor.unixtime();
+    uint32_t start = millis();
+    while (millis() - start < DS3231M_EDGE_TIMEOUT) {
+      if (readTime(anchor, 0) && anchor.unixtime() != first) {
+        _anchorMillis = millis();
+        _anchorUnix   = anchor.unixtime();
+        noInterrupts();
+        _anchorEdge = _edgeCount;  // An edge of this change came before the read
+        interrupts();
+        _anchorValid = true;
+        return true;
+      }  // if-then seconds changed
+    }    // of while-loop waiting for the seconds to change
+    return false;
+  }  // if-then no edges, anchor on the change of the seconds
+  for (uint8_t i = 0; i < 2; ++i) {
+    noInterrupts();  // Copy the ISR-updated value atomically
+    edgeCount = _edgeCount;
+    interrupts();
+    DateTime anchor;
+    if (!readTime(anchor)) {
+      return false;
+    }  // if-then read failed
+    _anchorMillis = millis();
+    _anchorUnix   = anchor.unixtime();
+    _anchorEdge   = edgeCount;
+    noInterrupts();
+    edgeCount = _edgeCount;
+    interrupts();
+    if (edgeCount == _anchorEdge) {
+      break;  // No edge during the read, so the anchor is consistent
+    }         // if-then no edge during the read
+  }           // of for-next each attempt
+  _anchorValid = true;
+  return true;
+}  // of method anchorTimeBase()
+DateTime DS3231M_Class::readClock() {
+  /*!
+   @brief     reads the current date/time from the RTC registers
+   @return    Current Date/Time
+  */
+  uint8_t buffer[7];                              // Image of the RTCSEC..RTCYEAR registers
+  if (readBytes(DS3231M_RTCSEC, buffer, 7) == 7)  // If all the data was read
   {
-    _ss = bcd2int(Wire.read() & 0x7F);         // Mask high bit in seconds
-    _mm = bcd2int(Wire.read() & 0x7F);         // Mask high bit in minutes
-    _hh = bcd2int(Wire.read() & 0x3F);         // Mask 2 high bits in hours and clamp to 0-23
-    Wire.read();                               // Read and ignore Day-Of-Week register
-    _d = bcd2int(Wire.read() & 0x3F);          // Mask 2 high bits for day of month
-    _m = bcd2int(Wire.read() & 0x1F);          // Mask 3 high bits for Month
-    _y = bcd2int(Wire.read()) + 2000;          // Add 2000 to internal year
+    return decodeClock(buffer);
   }                                            // of if-then there is data to be read
+  return DateTime(_y, _m, _d, _hh, _mm, _ss);  // Return last value read
+}  // of method readClock()
+bool DS3231M_Class::readTime(DateTime& dt, const uint8_t retries) {
+  /*!
+   @brief     reads the current date/time and reports whether the read succeeded
+   @details   The time registers are read in one burst, which the device latches at the I2C START
+              so that the value is coherent even across a rollover. The read is repeated when the
+              bus reports an error, fewer than 7 bytes arrive or the register values are not a
+              valid date/time, waiting DS3231M_RETRY_DELAY microseconds before the first retry and
+              doubling the wait for each further retry up to DS3231M_RETRY_DELAY_MAX. A good read
+              costs a single transaction
+   @param[out] dt Current Date/Time, only set when the read succeeds
+   @param[in] retries Number of retries after the first failed read
+   @return    true if a valid date/time was read
+  */
+  uint8_t  buffer[7];  // Image of the RTCSEC..RTCYEAR registers
+  uint16_t wait = DS3231M_RETRY_DELAY;
+  for (uint8_t attempt = 0;; ++attempt) {
+    if (readBytes(DS3231M_RTCSEC, buffer, 7) == 7 && _TransmissionStatus == 0 &&
+        validClock(buffer)) {
+      dt = decodeClock(buffer);
+      return true;
+    }  // if-then good read
+    if (attempt == retries) {
+      return false;
+    }  // if-then no retries left
+    delayMicroseconds(wait);
+    wait = wait < DS3231M_RETRY_DELAY_MAX / 2 ? wait * 2 : DS3231M_RETRY_DELAY_MAX;  // Back off
+  }  // for-next each attempt
+}  // of method readTime()
+bool DS3231M_Class::snapshot(DS3231M_Snapshot& snap) {
+  /*!
+   @brief     reads all registers 0x00 to 0x12 in a single burst and decodes them
+   @details   Replaces the separate now(), temperature(), isStopped(), isAlarm(), getAgingOffset()
+              and weekdayRead() transactions of a status report with one transaction. When the
+              register shadow copy is active (see refresh()) it is updated from the same read
+   @param[out] snap Decoded register contents, only set when the read succeeds
+   @return    true if all the registers were read
+  */
+  uint8_t buffer[DS3231M_REGISTERS];
+  if (readBytes(DS3231M_RTCSEC, buffer, DS3231M_REGISTERS) != DS3231M_REGISTERS ||
+      _TransmissionStatus != 0) {
+    return false;
+  }  // if-then read failed
+  const uint8_t* alarm1 = buffer + DS3231M_ALM1SEC;
+  const uint8_t* alarm2 = buffer + DS3231M_ALM2MIN;
+  uint8_t        control = buffer[DS3231M_CONTROL];
+  uint8_t        status  = buffer[DS3231M_STATUS];
+  snap.time              = decodeClock(buffer);
+  snap.weekday           = DS3231M_WEEKDAY.get(buffer[DS3231M_RTCWKDAY]);
+  uint8_t masks = DS3231M_A1M1.get(alarm1[0]) | DS3231M_A1M2.get(alarm1[1]) << 1 |
+                  DS3231M_A1M3.get(alarm1[2]) << 2 | DS3231M_A1M4.get(alarm1[3]) << 3;
+  switch (masks) {
+    case 0x0F: snap.alarm1Type = everySecond; break;
+    case 0x0E: snap.alarm1Type = secondsMatch; break;
+    case 0x0C: snap.alarm1Type = secondsMinutesMatch; break;
+    case 0x08: snap.alarm1Type = secondsMinutesHoursMatch; break;
+    case 0x00:
+      snap.alarm1Type = DS3231M_A1DYDT.get(alarm1[3]) ? secondsMinutesHoursDayMatch
+                                                      : secondsMinutesHoursDateMatch;
+      break;
+    default: snap.alarm1Type = UnknownAlarm;
+  }  // of switch alarm 1 mask bits
+  snap.alarm1Second = bcd2int(alarm1[0] & 0x7F);
+  snap.alarm1Minute = bcd2int(alarm1[1] & 0x7F);
+  snap.alarm1Hour   = bcd2int(alarm1[2] & 0x3F);
+  snap.alarm1Day    = bcd2int(alarm1[3] & 0x3F);
+  masks             = DS3231M_A2M2.get(alarm2[0]) | DS3231M_A2M3.get(alarm2[1]) << 1 |
+          DS3231M_A2M4.get(alarm2[2]) << 2;
+  switch (masks) {
+    case 0x07: snap.alarm2Type = everyMinute; break;
+    case 0x06: snap.alarm2Type = minutesMatch; break;
+    case 0x04: snap.alarm2Type = minutesHoursMatch; break;
+    case 0x00:
+      snap.alarm2Type =
+          DS3231M_A2DYDT.get(alarm2[2]) ? minutesHoursDayMatch : minutesHoursDateMatch;
+      break;
+    default: snap.alarm2Type = UnknownAlarm;
+  }  // of switch alarm 2 mask bits
+  snap.alarm2Minute    = bcd2int(alarm2[0] & 0x7F);
+  snap.alarm2Hour      = bcd2int(alarm2[1] & 0x3F);
+  snap.alarm2Day       = bcd2int(alarm2[2] & 0x3F);
+  snap.control         = control;
+  snap.status          = status;
+  snap.alarm1Enabled   = DS3231M_A1IE.get(control);
+  snap.alarm2Enabled   = DS3231M_A2IE.get(control);
+  snap.alarm1Triggered = DS3231M_A1F.get(status);
+  snap.alarm2Triggered = DS3231M_A2F.get(status);
+  snap.stopped         = DS3231M_OSF.get(status);
+  snap.kHz32           = DS3231M_EN32KHZ.get(status);
+  snap.pinAlarm        = DS3231M_INTCN.get(control);
+  snap.agingOffset     = buffer[DS3231M_AGING];
+  snap.temperature     = decodeTemperature(buffer + DS3231M_TEMPERATURE);
+  if (_shadowValid) {
+    memcpy(_shadow, alarm1, sizeof(_shadow));  // Same registers as the shadow copy
+    uint8_t& shadowControl = _shadow[DS3231M_CONTROL - DS3231M_ALM1SEC];
+    shadowControl          = DS3231M_CONV(0).apply(shadowControl);  // CONV clears itself
+  }  // if-then shadow copy active
+  return true;
+}  // of method snapshot()
+bool DS3231M_Class::validClock(const uint8_t* buffer) {
+  /*!
+   @brief     checks that a RTCSEC..RTCYEAR register image holds a valid 24 hour date/time
+   @details   Bus errors that pull lines high or low show up as invalid BCD digits or values out of
+              range, so this catches corrupted reads that still returned 7 bytes
+   @param[in] buffer 7 byte image of the time registers
+   @return    true if all the fields are valid
+  */
+  static const uint8_t limits[7] = {0x59, 0x59, 0x23, 0x07, 0x31, 0x12, 0x99};  // BCD maxima
+  for (uint8_t i = 0; i < 7; ++i) {
+    uint8_t value = (i == 5) ? (buffer[i] & 0x7F) : buffer[i];  // Ignore the century bit
+    if ((value & 0x0F) > 9 || value > limits[i]) {
+      return false;
+    }  // if-then invalid BCD or out of range
+  }    // for-next each register
+  uint8_t day   = bcd2int(buffer[4]);
+  uint8_t month = bcd2int(buffer[5] & 0x1F);
+  uint8_t year  = bcd2int(buffer[6]);
+  if (buffer[3] == 0 || day == 0 || month == 0) {
+    return false;
+  }  // if-then zero weekday, day or month
+  return day <= DateTime::daysInMonth(year, month);
+}  // of method validClock()
+DateTime DS3231M_Class::decodeClock(const uint8_t* buffer) {
+  /*!
+   @brief     decodes the RTCSEC..RTCYEAR register image and stores the date components
+   @param[in] buffer 7 byte image of the time registers
+   @return    Decoded Date/Time
+  */
+  _ss = bcd2int(buffer[0] & 0x7F);             // Mask high bit in seconds
+  _mm = bcd2int(buffer[1] & 0x7F);             // Mask high bit in minutes
+  _hh = bcd2int(buffer[2] & 0x3F);             // Mask 2 high bits in hours and clamp to 0-23
+  _d  = bcd2int(buffer[4] & 0x3F);             // Mask 2 high bits for day of month
+  _m  = bcd2int(buffer[5] & 0x1F);             // Mask 3 high bits for Month
+  _y  = bcd2int(buffer[6]) + 2000;             // Add 2000 to internal year
   return DateTime(_y, _m, _d, _hh, _mm, _ss);  // Return class value
-}  // of method now()
+}  // of method decodeClock()
+int32_t DS3231M_Class::decodeTemperature(const uint8_t* buffer) {
+  /*!
+   @brief     decodes the 2 byte temperature register image
+   @details   The temperature is a 10 bit two's complement value in 0.25 degree steps, left aligned
+   @param[in] buffer 2 byte image of the temperature registers
+   @return    temperature in 1/100 degrees Celsius
+  */
+  int16_t temp = (int16_t)((uint16_t)buffer[0] << 8 | buffer[1]) >> 6;  // Keeps the sign
+  return (int32_t)temp * 25;                                            // 0.25C increments
+}  // of method decodeTemperature()
+bool DS3231M_Class::requestAsync(const uint8_t requestType, asyncCallback callback) {
+  /*!
+   @brief     queues a non-blocking read of the time, temperature or status registers
+   @details   The request is carried out by subsequent calls to pollAsync(), which never perform
+              more than one I2C transfer per call. When the request completes the result is
+              available from asyncTime(), asyncTemperature() or asyncStatus(), asyncSuccess() tells
+              whether it was read, and the optional callback function is called from within
+              pollAsync()
+   @param[in] requestType Request type, see the asyncRequestTypes enumerated values
+   @param[in] callback Optional function called when the request has completed
+   @return    false if the request type is invalid or the queue is full
+  */
+  if (requestType >= UnknownRequest || _asyncCount == DS3231M_ASYNC_QUEUE) {
+    return false;
+  }  // if-then invalid type or queue full
+  uint8_t slot         = (_asyncHead + _asyncCount) % DS3231M_ASYNC_QUEUE;
+  _asyncType[slot]     = requestType;
+  _asyncCallback[slot] = callback;
+  ++_asyncCount;
+  return true;
+}  // of method requestAsync()
+uint8_t DS3231M_Class::pollAsync() {
+  /*!
+   @brief     advances the queued non-blocking requests by one step
+   @details   Each request takes 2 calls, the first sends the register address and the second reads
+              and decodes the data. If any other I2C transaction was made by the library between the
+              two steps then the register address is sent again. When the register address is not
+              acknowledged the request completes as failed without a read, see asyncSuccess()
+   @return    Number of requests still queued, 0 when idle
+  */
+  if (_asyncCount == 0) {
+    return 0;
+  }  // if-then nothing to do
+  static const uint8_t registers[] = {DS3231M_RTCSEC, DS3231M_TEMPERATURE, DS3231M_STATUS};
+  static const uint8_t lengths[]   = {7, 2, 1};
+  uint8_t              type        = _asyncType[_asyncHead];
+  if (!_asyncAddressed || _asyncSequence != _readCount + _writeCount) {
+#if DS3231M_INSTRUMENTATION
+    uint32_t startMicros = micros();
+#endif
+    _TransmissionStatus = _bus->write(_address, registers[type], nullptr, 0);  // Register address
+#if DS3231M_INSTRUMENTATION
+    record(registers[type], true, 0, 0, startMicros);  // Counted as a write without data
+#endif
+    if (_TransmissionStatus != 0) {
+      return finishAsync(false);  // No read from an unknown register pointer
+    }                             // if-then address not acknowledged
+    _asyncAddressed = true;
+    _asyncSequence  = _readCount + _writeCount;
+    return _asyncCount;
+  }  // if-then register address needs sending
+  uint8_t buffer[7];
+#if DS3231M_INSTRUMENTATION
+  uint32_t startMicros = micros();
+#endif
+  ++_readCount;                                                     // Count the read transaction
+  uint8_t bytesRead = _bus->read(_address, buffer, lengths[type]);  // Request the data
+#if DS3231M_INSTRUMENTATION
+  record(registers[type], false, lengths[type], bytesRead, startMicros);
+#endif
+  bool success = bytesRead == lengths[type] && (type != timeRequest || validClock(buffer));
+  if (success) {
+    switch (type) {
+      case timeRequest: _asyncTime = decodeClock(buffer).unixtime(); break;
+      case temperatureRequest: _asyncTemperature = decodeTemperature(buffer); break;
+      case statusRequest: _asyncStatus = buffer[0]; break;
+    }  // of switch for the request type
+  }    // if-then all the data was read
+  return finishAsync(success);
+}  // of method pollAsync()
+uint8_t DS3231M_Class::finishAsync(const bool success) {
+  /*!
+   @brief     completes the non-blocking request in progress and calls its callback
+   @param[in] success Whether the result was read, see asyncSuccess()
+   @return    Number of requests still queued
+  */
+  uint8_t       type     = _asyncType[_asyncHead];
+  asyncCallback callback = _asyncCallback[_asyncHead];
+  _asyncAddressed        = false;
+  _asyncSuccess          = success;
+  _asyncHead             = (_asyncHead + 1) % DS3231M_ASYNC_QUEUE;
+  --_asyncCount;
+  if (callback != nullptr) {
+    callback(type);  // Call after dequeuing so the callback can queue a new request
+  }                  // if-then callback defined
+  return _asyncCount;
+}  // of method finishAsync()
+bool DS3231M_Class::asyncSuccess() {
+  /*!
+   @brief     returns whether the last completed request read its result
+   @details   After a failed request asyncTime(), asyncTemperature() or asyncStatus() still return
+              the result of the last successful request of that type
+   @return    true if the last completed request succeeded
+  */
+  return _asyncSuccess;
+}  // of method asyncSuccess()
+DateTime DS3231M_Class::asyncTime() {
+  /*!
+   @brief     returns the result of the last completed timeRequest
+   @return    Date/Time read
+  */
+  return DateTime(_asyncTime);
+}  // of method asyncTime()
+int32_t DS3231M_Class::asyncTemperature() {
+  /*!
+   @brief     returns the result of the last completed temperatureRequest
+   @return    temperature in 1/100 degrees Celsius
+  */
+  return _asyncTemperature;
+}  // of method asyncTemperature()
+uint8_t DS3231M_Class::asyncStatus() {
+  /*!
+   @brief     returns the result of the last completed statusRequest
+   @return    STATUS register value
+  */
+  return _asyncStatus;
+}  // of method asyncStatus()
 int32_t DS3231M_Class::temperature() {
   /*!
-   @brief     returns the internal temperature in tenths of degrees Celsius
-   @details   Using 1/10 of degrees allows use of integer rather than floating point
-   @return    temperature in 1/10 degrees Celsius
-  */
-  int32_t temp = readByte(DS3231M_TEMPERATURE) << 8;  // read MSB
-  temp |= readByte(DS3231M_TEMPERATURE + 1);          // get LSB
-  temp = temp >> 6;                                   // Shift over 6 bits
-  if (temp & 0x200) {
-    temp |= 0xFC00;       // keep negative by setting bits
-  }                       // if-then a negative number
-  temp = temp * 100 / 4;  // value is in .25C increments
-  return temp;            // Return computed temperature
+   @brief     returns the internal temperature in hundredths of degrees Celsius
+   @details   Using 1/100 of degrees allows use of integer rather than floating point. Both
+              registers are read in one burst so that MSB and LSB belong to the same conversion
+   @return    temperature in 1/100 degrees Celsius
+  */
+  uint8_t buffer[2] = {0, 0};                   // Temperature MSB and LSB
+  readBytes(DS3231M_TEMPERATURE, buffer, 2);    // Read both in one burst
+  return decodeTemperature(buffer);             // Return computed temperature
 }  // of method temperature()
+bool DS3231M_Class::temperature(int32_t& temp) {
+  /*!
+   @brief     reads the internal temperature and reports whether the read succeeded (Overloaded)
+   @param[out] temp temperature in 1/100 degrees Celsius, only set when the read succeeds
+   @return    true if both temperature registers were read
+  */
+  uint8_t buffer[2];  // Temperature MSB and LSB
+  if (readBytes(DS3231M_TEMPERATURE, buffer, 2) != 2 || _TransmissionStatus != 0) {
+    return false;
+  }  // if-then read failed
+  temp = decodeTemperature(buffer);
+  return true;
+}  // of method temperature()
+bool DS3231M_Class::startConversion() {
+  /*!
+   @brief     starts a temperature conversion
+   @details   The DS3231M converts automatically every 64 seconds, this forces an immediate new
+              conversion by setting the CONV bit. The result is collected with readConversion()
+   @return    false if a conversion is already in progress or the registers could not be read
+  */
+  uint8_t buffer[2];  // CONTROL and STATUS registers
+  if (readBytes(DS3231M_CONTROL, buffer, 2) != 2 || _TransmissionStatus != 0) {
+    return false;  // Read failed, never write back a value that was not read
+  }                // if-then read failed
+  if (DS3231M_CONV.get(buffer[0]) || DS3231M_BSY.get(buffer[1])) {
+    return false;  // CONV or BSY set, a conversion is in progress
+  }                // if-then busy
+  writeByte(DS3231M_CONTROL, DS3231M_CONV(1).apply(buffer[0]));  // Start the conversion
+  return true;
+}  // of method startConversion()
+bool DS3231M_Class::readConversion(int32_t& temp) {
+  /*!
+   @brief     returns the temperature once a conversion started with startConversion() completes
+   @details   This does not block, CONTROL through the temperature registers are read in a single
+              burst and the temperature is only returned once the CONV bit has cleared
+   @param[out] temp temperature in 1/100 degrees Celsius, only set when the conversion is done
+   @return    true when the conversion has completed and "temp" has been set
+  */
+  uint8_t buffer[5];  // CONTROL, STATUS, AGING and temperature MSB and LSB
+  if (readBytes(DS3231M_CONTROL, buffer, 5) != 5 || _TransmissionStatus != 0 ||
+      DS3231M_CONV.get(buffer[0])) {
+    return false;  // Read failed or CONV still set
+  }                // if-then not finished
+  temp = decodeTemperature(buffer + 3);
+  return true;
+}  // of method readConversion()
+uint32_t DS3231M_Class::lastSet() {
+  /*!
+   @brief     returns the UNIX time that the clock was last set to with adjust()
+   @return    UNIX time, 0 if the clock has not been set since begin()
+  */
+  return _SetUnixTime;
+}  // of method lastSet()
+uint8_t DS3231M_Class::transmissionStatus() {
+  /*!
+   @brief     returns the status of the last I2C transaction
+   @return    0 on success, 2 or 3 for a NACK of the address or data, 5 for a timeout, other
+              values for other errors as returned by the "Wire" endTransmission()
+  */
+  return _TransmissionStatus;
+}  // of method transmissionStatus()
+bool DS3231M_Class::statistics(const uint8_t operation, DS3231M_Statistics& snapshot) {
+  /*!
+   @brief     copies the I2C statistics of one operation type
+   @details   The statistics are only kept when the compiler flag DS3231M_INSTRUMENTATION is set
+              to 1, otherwise this always returns false
+   @param[in] operation Operation type, see the busOperations enumerated values
+   @param[out] snapshot Copy of the statistics
+   @return    false if instrumentation is off or the operation type is out of range
+  */
+#if DS3231M_INSTRUMENTATION
+  if (operation < busOperationCount) {
+    snapshot = _statistics[operation];
+    return true;
+  }  // if-then valid operation
+#else
+  (void)operation;
+  (void)snapshot;
+#endif
+  return false;
+}  // of method statistics()
+void DS3231M_Class::resetStatistics() {
+  /*!
+   @brief     resets all the I2C statistics
+  */
+#if DS3231M_INSTRUMENTATION
+  memset(_statistics, 0, sizeof(_statistics));
+#endif
+}  // of method resetStatistics()
+void DS3231M_Class::record(const uint8_t addr, const bool write, const uint8_t requested,
+                           const uint8_t moved, const uint32_t startMicros) {
+  /*!
+   @brief     records the statistics of an I2C transaction
+   @details   The operation type is derived from the starting register and the direction
+   @param[in] addr Starting register address
+   @param[in] write True for a write transaction
+   @param[in] requested Number of data bytes requested
+   @param[in] moved Number of data bytes actually transferred
+   @param[in] startMicros micros() at the start of the transaction
+  */
+#if DS3231M_INSTRUMENTATION
+  uint32_t elapsed = micros() - startMicros;
+  uint16_t latency = elapsed > 0xFFFF ? 0xFFFF : elapsed;
+  uint8_t  group   = addr < DS3231M_ALM1SEC   ? 0
+                     : addr < DS3231M_CONTROL ? 1
+                     : addr < DS3231M_AGING   ? 2
+                     : addr == DS3231M_AGING  ? 3
+                                              : 4;
+  DS3231M_Statistics& stats = _statistics[group * 2 + write];
+  if (stats.transactions == 0 || latency < stats.latencyMin) {
+    stats.latencyMin = latency;
+  }  // if-then new minimum
+  if (latency > stats.latencyMax) {
+    stats.latencyMax = latency;
+  }  // if-then new maximum
+  ++stats.transactions;
+  stats.bytes += moved;
+  stats.latencyTotal += latency;
+  if (_TransmissionStatus == 2 || _TransmissionStatus == 3) {
+    ++stats.nacks;
+  } else if (_TransmissionStatus == 5) {
+    ++stats.timeouts;
+  } else if (_TransmissionStatus != 0) {
+    ++stats.errors;
+  }  // if-then-else error type
+  if (!write && moved < requested) {
+    ++stats.shortReads;
+  }  // if-then short read
+#else
+  (void)addr;
+  (void)write;
+  (void)requested;
+  (void)moved;
+  (void)startMicros;
+#endif
+}  // of method record()
 bool DS3231M_Class::isStopped() {
   /*!
    @brief  Check to see if the oscillator is running
    @return return false if the oscillator is running, otherwise return true
   */
-  return (readByte(DS3231M_STATUS) >> 7);  // shift OSF register bit to LSB for true/false
+  return readByte(DS3231M_STATUS) & DS3231M_OSF.mask;  // Oscillator stop flag
 }  // of method isAlarm()
 void DS3231M_Class::setAlarm(const uint8_t alarmType, const DateTime dt, const bool state) {
   /*!
    @brief     will set one of the 2 alarms
    @details   As the two alarms aren't identical in what will trigger them, this call chooses which
-              alarm to set depending upon the "alarmType" parameter value.
+              alarm to set depending upon the "alarmType" parameter value. The flags of both alarms
+              are cleared
    @param[in] alarmType Alarm Type, see the alarm type enumerated values
    @param[in] dt Date/Time to set the alarm to
    @param[in] state Alarm Enable state
   */
+  writeAlarm(alarmType, dt, state, DS3231M_ALARM1 | DS3231M_ALARM2);
+}  // of method setAlarm
+void DS3231M_Class::writeAlarm(const uint8_t alarmType, const DateTime& dt, const bool state,
+                               const uint8_t clear) {
+  /*!
+   @brief     programs one of the 2 alarms
+   @details   The complete alarm register image including the mask bits is computed first and then
+              written in one burst, followed by a single combined CONTROL/STATUS update
+   @param[in] alarmType Alarm Type, see the alarm type enumerated values
+   @param[in] dt Date/Time to set the alarm to
+   @param[in] state Alarm Enable state
+   @param[in] clear DS3231M_ALARM1 and/or DS3231M_ALARM2 for the flags to clear
+  */
   if (alarmType >= UnknownAlarm) {
-    return;                     // Don't do anything if out-of-range
-  }                             // if-then out of range alarm type
+    return;  // Don't do anything if out-of-range
+  }          // if-then out of range alarm type
+  uint8_t buffer[4];            // Alarm register image
+  uint8_t enable;               // A1IE or A2IE bit in CONTROL
   if (alarmType < everyMinute)  // These types go to alarm 1
   {
-    writeByte(DS3231M_ALM1SEC, int2bcd(dt.second()));  // Set seconds value
-    writeByte(DS3231M_ALM1MIN, int2bcd(dt.minute()));  // Set minutes value
-    writeByte(DS3231M_ALM1HOUR, int2bcd(dt.hour()));   // Set hours value
-    if (alarmType == secondsMinutesHoursDateMatch)     // Set either day of month or day
+    buffer[0] = int2bcd(dt.second());               // ALM1SEC
+    buffer[1] = int2bcd(dt.minute());               // ALM1MIN
+    buffer[2] = int2bcd(dt.hour());                 // ALM1HOUR
+    if (alarmType == secondsMinutesHoursDateMatch)  // Set either day of month or day
     {
-      writeByte(DS3231M_ALM1DATE, int2bcd(dt.day()));
+      buffer[3] = int2bcd(dt.day());
     } else {
-      writeByte(DS3231M_ALM1DATE, int2bcd(dt.dayOfTheWeek()));
-    }                                              // if-then-else DateMathc
-    if (alarmType < secondsMinutesHoursDateMatch)  // Set the high-bit of ALM1DATE if the alarm bit
-                                                   // needs setting
-      writeByte(DS3231M_ALM1DATE, readByte(DS3231M_ALM1DATE) | 0x80);
-    if (alarmType <
-        secondsMinutesHoursMatch)  // Set the high-bit of ALM1HOUR if the alarm bit needs setting
-      writeByte(DS3231M_ALM1HOUR, readByte(DS3231M_ALM1HOUR) | 0x80);
-    if (alarmType <
-        secondsMinutesMatch)  // Set the high-bit of ALM1MIN if the alarm bit needs setting
-      writeByte(DS3231M_ALM1MIN, readByte(DS3231M_ALM1MIN) | 0x80);
-    if (alarmType == everySecond)  // Set the high-bit of ALM1SEC if the alarm bit needs setting
-      writeByte(DS3231M_ALM1SEC, readByte(DS3231M_ALM1SEC) | 0x80);
-    if (alarmType == secondsMinutesHoursDayMatch)  // Set bit 7 if the alarm bit needs setting
-      writeByte(DS3231M_ALM1DATE, readByte(DS3231M_ALM1DATE) | 0x40);
-    if (state)
-      writeByte(DS3231M_CONTROL, readByte(DS3231M_CONTROL) | 1);  // Set A1IE enable to on
-    else
-      writeByte(DS3231M_CONTROL, readByte(DS3231M_CONTROL) & 0xFE);  // Set A1IE enable to off
+      buffer[3] = int2bcd(dt.dayOfTheWeek());
+    }                                                                     // if-then-else DateMatch
+    if (alarmType == everySecond) { buffer[0] |= DS3231M_A1M1.mask; }
+    if (alarmType < secondsMinutesMatch) { buffer[1] |= DS3231M_A1M2.mask; }
+    if (alarmType < secondsMinutesHoursMatch) { buffer[2] |= DS3231M_A1M3.mask; }
+    if (alarmType < secondsMinutesHoursDateMatch) { buffer[3] |= DS3231M_A1M4.mask; }
+    if (alarmType == secondsMinutesHoursDayMatch) { buffer[3] |= DS3231M_A1DYDT.mask; }
+    writeBytes(DS3231M_ALM1SEC, buffer, 4);  // Write the alarm image in one burst
+    enable = DS3231M_A1IE.mask;
   } else {
-    writeByte(DS3231M_ALM2MIN, int2bcd(dt.minute()));  // Set minutes value
-    writeByte(DS3231M_ALM2HOUR, int2bcd(dt.hour()));   // Set hours value
-    if (alarmType == minutesHoursDateMatch)            // If we do a min-hh-date match
-      writeByte(DS3231M_ALM2DATE, int2bcd(dt.day()));  // Set day of month value
-    else if (alarmType == minutesHoursDayMatch)        // if we have a min-hh-dow match
-      writeByte(DS3231M_ALM2DATE,
-                int2bcd(dt.dayOfTheWeek() | 0x80));  // Set day of week value and switch
-    if (alarmType < minutesHoursDateMatch)
-      writeByte(DS3231M_ALM2DATE,
-                readByte(DS3231M_ALM2DATE) | 0x80);  // the alarm bit needs setting
-    if (alarmType < minutesHoursMatch)
-      writeByte(DS3231M_ALM2HOUR,
-                readByte(DS3231M_ALM2HOUR) | 0x80);  // the alarm bit needs setting
-    if (alarmType == everyMinute)
-      writeByte(DS3231M_ALM2MIN, readByte(DS3231M_ALM2MIN) | 0x80);  // the alarm bit needs setting
-    if (state)
-      writeByte(DS3231M_CONTROL, readByte(DS3231M_CONTROL) | 2);  // Set A2IE enable to on
-    else
-      writeByte(DS3231M_CONTROL, readByte(DS3231M_CONTROL) & 0xFD);  // Set A2IE enable to off
-  }              // of if-then-else use alarm 1 or 2
-  clearAlarm();  // Clear the alarm state
-  return;
-}  // of method setAlarm
+    buffer[0] = int2bcd(dt.minute());       // ALM2MIN
+    buffer[1] = int2bcd(dt.hour());         // ALM2HOUR
+    if (alarmType == minutesHoursDayMatch)  // Set either day of week or day of month
+    {
+      buffer[2] = int2bcd(dt.dayOfTheWeek()) | DS3231M_A2DYDT.mask;  // Day of week
+    } else {
+      buffer[2] = int2bcd(dt.day());
+    }                                                              // if-then-else DayMatch
+    if (alarmType == everyMinute) { buffer[0] |= DS3231M_A2M2.mask; }
+    if (alarmType < minutesHoursMatch) { buffer[1] |= DS3231M_A2M3.mask; }
+    if (alarmType < minutesHoursDateMatch) { buffer[2] |= DS3231M_A2M4.mask; }
+    writeBytes(DS3231M_ALM2MIN, buffer, 3);  // Write the alarm image in one burst
+    enable = DS3231M_A2IE.mask;
+  }  // of if-then-else use alarm 1 or 2
+  update(DS3231M_Update{DS3231M_CONTROL, enable, state ? enable : (uint8_t)0},
+         DS3231M_Update{DS3231M_STATUS, clear, 0});  // Set AxIE and clear the alarm flags
+}  // of method writeAlarm()
 bool DS3231M_Class::isAlarm() {
   /*!
    @brief  return whether either of the two alarms has been triggered
    @return true if either of the 2 alarms is triggered, otherwise false
   */
-  uint8_t controlByte =
-      readByte(DS3231M_CONTROL) & 0x02;                  // Mask out all but last 2 bits for ALM1&2
-  uint8_t statusByte = readByte(DS3231M_STATUS) & 0x02;  // Mask out all but last 2 bits for ALM1&2
-  return (controlByte & statusByte);                     // Nonzero when alarm and switch bits set
+  uint8_t buffer[2];  // CONTROL and STATUS
+  return readAlarmState(buffer) && triggered(buffer) != 0;
 }  // of method isAlarm()
 void DS3231M_Class::clearAlarm() {
   /*!
    @brief  Clear a set alarm by re-writing the same contents back to the register
   */
-  writeByte(DS3231M_STATUS, readByte(DS3231M_STATUS) & 0xFC);  // Alarm if either of 2 LSBits set
+  update(DS3231M_A1F(0) | DS3231M_A2F(0));  // Clear both alarm flags
 }  // of method clearAlarm()
+void DS3231M_Class::clearAlarm(const uint8_t alarms) {
+  /*!
+   @brief     clears the flags of the given alarms and leaves the other one unchanged (Overloaded)
+   @param[in] alarms DS3231M_ALARM1 and/or DS3231M_ALARM2
+  */
+  update(DS3231M_Update{DS3231M_STATUS, (uint8_t)(alarms & (DS3231M_ALARM1 | DS3231M_ALARM2)), 0});
+}  // of method clearAlarm()
+uint8_t DS3231M_Class::serviceAlarms() {
+  /*!
+   @brief     returns the alarms that have triggered and clears only their flags
+   @details   Meant for the handler of the INT/SQW alarm interrupt. CONTROL and STATUS are read in
+              one burst, or only STATUS when the register shadow copy is valid, and STATUS is only
+              written when an alarm has triggered. Writing a 1 to a flag leaves it unchanged, so
+              the write sets all the other flags to 1 and an alarm triggering between the read and
+              the write is kept for the next call
+   @return    DS3231M_ALARM1 and/or DS3231M_ALARM2 for each enabled alarm that has triggered
+  */
+  uint8_t buffer[2];  // CONTROL and STATUS
+  if (!readAlarmState(buffer)) {
+    return 0;
+  }  // if-then read failed
+  uint8_t fired = triggered(buffer);
+  if (fired) {
+    writeByte(DS3231M_STATUS, (buffer[1] | DS3231M_A1F.mask | DS3231M_A2F.mask) & ~fired);
+  }  // if-then clear the flags of the triggered alarms
+  return fired;
+}  // of method serviceAlarms()
+bool DS3231M_Class::readAlarmState(uint8_t* buffer) {
+  /*!
+   @brief     reads CONTROL and STATUS with one I2C transaction
+   @details   CONTROL is taken from the register shadow copy when it is valid, STATUS is always read
+              from the device
+   @param[out] buffer CONTROL and STATUS register values
+   @return    true if the registers were read
+  */
+  if (_shadowValid) {
+    buffer[0] = _shadow[DS3231M_CONTROL - DS3231M_ALM1SEC];
+    return readBytes(DS3231M_STATUS, buffer + 1, 1) == 1 && _TransmissionStatus == 0;
+  }  // if-then CONTROL is shadowed
+  return readBytes(DS3231M_CONTROL, buffer, 2) == 2 && _TransmissionStatus == 0;
+}  // of method readAlarmState()
+uint8_t DS3231M_Class::triggered(const uint8_t* buffer) {
+  /*!
+   @brief     returns the alarms that are both enabled in CONTROL and flagged in STATUS
+   @param[in] buffer CONTROL and STATUS register values
+   @return    DS3231M_ALARM1 and/or DS3231M_ALARM2
+  */
+  return buffer[0] & buffer[1] & (DS3231M_A1IE.mask | DS3231M_A2IE.mask);
+}  // of method triggered()
+static_assert(DS3231M_A1IE.mask == DS3231M_A1F.mask && DS3231M_A1F.mask == DS3231M_ALARM1,
+              "Alarm 1 enable, flag and result bits match");
+static_assert(DS3231M_A2IE.mask == DS3231M_A2F.mask && DS3231M_A2F.mask == DS3231M_ALARM2,
+              "Alarm 2 enable, flag and result bits match");
 void DS3231M_Class::kHz32(const bool state) {
   /*!
    @brief     Turns the 32.768kHz output on the 32Khz pin on or off
+   @details   With the register shadow copy active STATUS is not read, EN32kHz is only written
+              when it changes and the flags are written as 1, which leaves them unchanged
    @param[in] state "True" to turn the output on, otherwise turn off
   */
-  writeByte(DS3231M_STATUS,
-            (readByte(DS3231M_STATUS) & 0xF7) | (state << 3));  // Set bit 3 to state
+  if (_shadowValid) {
+    if (DS3231M_EN32KHZ.get(_shadow[DS3231M_STATUS - DS3231M_ALM1SEC]) != state) {
+      writeByte(DS3231M_STATUS, writeValue(DS3231M_EN32KHZ(state), 0));  // No read needed
+    }  // if-then shadowed state differs
+    return;
+  }                                // if-then shadow copy active
+  update(DS3231M_EN32KHZ(state));  // Set EN32kHz to state
 }  // of method kHz32()
 int8_t DS3231M_Class::getAgingOffset() {
   /*!
    @brief  return the aging offset value from the DS3231M
    @return signed integer value for the aging offset
   */
-  return (readByte(DS3231M_AGING));
+  return (readRegister(DS3231M_AGING));
+}  // of method getAgingOffset()
+bool DS3231M_Class::getAgingOffset(int8_t& agingOffset) {
+  /*!
+   @brief     reads the aging offset and reports whether the read succeeded (Overloaded)
+   @param[out] agingOffset signed aging offset, only set when the read succeeds
+   @return    true if the register was taken from the shadow copy or read from the device
+  */
+  uint8_t value;
+  if (!readRegister(DS3231M_AGING, value)) {
+    return false;
+  }  // if-then read failed
+  agingOffset = value;
+  return true;
 }  // of method getAgingOffset()
 int8_t DS3231M_Class::setAgingOffset(const int8_t agingOffset) {
   /*!
@@ -490,7 +1430,7 @@ int8_t DS3231M_Class::setAgingOffset(const int8_t agingOffset) {
    @return    New value read from register after setting
   */
   writeByte(DS3231M_AGING, agingOffset);
-  return (readByte(DS3231M_AGING));
+  return (readRegister(DS3231M_AGING));
 }  // of method setAgingOffset()
 uint8_t DS3231M_Class::weekdayRead() {
   /*!
@@ -499,7 +1439,7 @@ uint8_t DS3231M_Class::weekdayRead() {
             of the adjust() method where Monday is weekday 1
    @return  Current weekday, Monday=1 and Sunday=7
   */
-  uint8_t dow = readByte(DS3231M_RTCWKDAY) & B00000111;  // no need to convert, values 1-7
+  uint8_t dow = DS3231M_WEEKDAY.get(readByte(DS3231M_RTCWKDAY));  // no need to convert, 1-7
   return dow;
 }  // of method weekdayRead()
 uint8_t DS3231M_Class::weekdayWrite(const uint8_t dow) {
@@ -521,7 +1461,7 @@ void DS3231M_Class::pinAlarm() {
   /*!
    @brief     Sets the control register flag to make the INT/SQW Pin get pulled up on an alarm
   */
-  writeByte(DS3231M_CONTROL, readByte(DS3231M_CONTROL) | 0x4);  // Set bit 3 to on
+  update(DS3231M_INTCN(1));  // INT/SQW signals alarms
 }  // of method pinAlarm()
 void DS3231M_Class::pinSquareWave() {
   /*!
@@ -530,7 +1470,7 @@ void DS3231M_Class::pinSquareWave() {
               the RS1 and RS2 bits to "0" so that the default is 1Hz for the DS3231. These
               bits are ignored by the DS3231M
   */
-  writeByte(DS3231M_CONTROL, readByte(DS3231M_CONTROL) & ~B0011100);
+  update(DS3231M_INTCN(0) | DS3231M_RS(0));  // 1Hz square wave, one read-modify-write
 }  // of method pinSquareWave()
 void DS3231M_Class::pinSquareWave(const uint8_t rate) {
   /*!
@@ -542,5 +1482,881 @@ void DS3231M_Class::pinSquareWave(const uint8_t rate) {
               and B11 = 8.192kHz
    @param[in] rate Code for Hz rate
 */
-  writeByte(DS3231M_CONTROL, (readByte(DS3231M_CONTROL) & ~B0011100) | (rate & B00000011) << 3);
+  update(DS3231M_INTCN(0) | DS3231M_RS(rate));  // Square wave at "rate"
 }  // of method pinSquareWave()
+DS3231M_Scheduler::DS3231M_Scheduler(DS3231M_Class& rtc) : _rtc(&rtc) {
+  /*!
+   @brief     Class constructor
+   @param[in] rtc DS3231M_Class instance whose alarm 1 is used
+  */
+  for (schedulerHandle i = 0; i < DS3231M_SCHEDULER_SIZE; ++i) {
+    _position[i] = DS3231M_SCHEDULER_FULL;  // Mark all handles as free
+  }                                         // for-next each handle
+}  // of class constructor
+void DS3231M_Scheduler::begin() {
+  /*!
+   @brief     sets the INT/SQW pin to signal alarms
+   @details   The DS3231M_Class begin() method needs to have been called first
+  */
+  _rtc->pinAlarm();
+}  // of method begin()
+static_assert(DS3231M_SCHEDULER_SIZE >= 1 && DS3231M_SCHEDULER_SIZE < 0xFFFF,
+              "DS3231M_SCHEDULER_SIZE must be 1 to 65534");
+schedulerHandle DS3231M_Scheduler::add(const DateTime& deadline, schedulerCallback callback) {
+  /*!
+   @brief     schedules an event
+   @details   Alarm 1 is reprogrammed if the new event is due before all others. An event with a
+              deadline in the past is dispatched by the next call to service()
+   @param[in] deadline Date/Time when the callback is to be called
+   @param[in] callback Function to call
+   @return    Handle of the event, or DS3231M_SCHEDULER_FULL if there is no space left or no
+              callback
+  */
+  if (callback == nullptr) {
+    return DS3231M_SCHEDULER_FULL;
+  }  // if-then nothing to call
+  schedulerHandle handle = 0;
+  while (handle < DS3231M_SCHEDULER_SIZE && _position[handle] != DS3231M_SCHEDULER_FULL) {
+    ++handle;
+  }  // of while-loop look for a free handle
+  if (handle == DS3231M_SCHEDULER_SIZE) {
+    return DS3231M_SCHEDULER_FULL;
+  }  // if-then no free handle
+  _deadline[handle] = deadline.unixtime();
+  _callback[handle] = callback;
+  _heap[_count]     = handle;
+  _position[handle] = _count;
+  siftUp(_count++);
+  if (_heap[0] == handle) {
+    arm();  // New event is the next one due
+  }         // if-then new nearest deadline
+  return handle;
+}  // of method add()
+bool DS3231M_Scheduler::cancel(const schedulerHandle handle) {
+  /*!
+   @brief     cancels a scheduled event
+   @param[in] handle Handle returned by add()
+   @return    false if the handle isn't scheduled
+  */
+  if (handle >= DS3231M_SCHEDULER_SIZE || _position[handle] == DS3231M_SCHEDULER_FULL) {
+    return false;
+  }  // if-then invalid handle
+  bool wasNext = _position[handle] == 0;
+  removeAt(_position[handle]);
+  if (wasNext) {
+    arm();  // Reprogram the alarm for the new nearest deadline
+  }         // if-then canceled the next event
+  return true;
+}  // of method cancel()
+void DS3231M_Scheduler::alarmInterrupt() {
+  /*!
+   @brief     records that the INT/SQW pin signaled an alarm
+   @details   This is meant to be called from the interrupt routine attached to the INT/SQW pin, it
+              does no I2C traffic and is safe to call from an ISR
+  */
+  _fired = true;
+}  // of method alarmInterrupt()
+schedulerHandle DS3231M_Scheduler::service() {
+  /*!
+   @brief     dispatches all expired events and re-arms alarm 1
+   @details   This does nothing unless alarmInterrupt() has been called or an event was found to be
+              already due when it was armed. The callbacks may add or cancel events
+   @return    Number of events dispatched
+  */
+  if (!_fired) {
+    return 0;
+  }  // if-then no alarm
+  _fired                   = false;
+  uint32_t        current  = _rtc->now().unixtime();
+  schedulerHandle dispatch = 0;
+  _rtc->clearAlarm(DS3231M_ALARM1);  // Release the INT/SQW pin, alarm 2 is left alone
+  while (_count > 0 && _deadline[_heap[0]] <= current) {
+    schedulerHandle   handle   = _heap[0];
+    schedulerCallback callback = _callback[handle];
+    removeAt(0);  // Remove first so that the callback may reuse the handle
+    callback(handle);
+    ++dispatch;
+  }  // of while-loop expired events
+  arm();
+  return dispatch;
+}  // of method service()
+schedulerHandle DS3231M_Scheduler::pending() {
+  /*!
+   @brief     returns the number of scheduled events
+   @return    Number of events
+  */
+  return _count;
+}  // of method pending()
+void DS3231M_Scheduler::siftUp(schedulerHandle position) {
+  /*!
+   @brief     moves a heap entry towards the root until the heap order is restored
+   @param[in] position Heap position
+  */
+  while (position > 0) {
+    schedulerHandle parent = (position - 1) / 2;
+    if (_deadline[_heap[parent]] <= _deadline[_heap[position]]) {
+      break;
+    }  // if-then heap order is correct
+    swap(parent, position);
+    position = parent;
+  }  // of while-loop not at the root
+}  // of method siftUp()
+void DS3231M_Scheduler::siftDown(schedulerHandle position) {
+  /*!
+   @brief     moves a heap entry towards the leaves until the heap order is restored
+   @param[in] position Heap position
+  */
+  while (true) {
+    schedulerHandle smallest = position;
+    uint32_t        child    = 2UL * position + 1;  // May be past the largest handle
+    if (child < _count && _deadline[_heap[child]] < _deadline[_heap[smallest]]) {
+      smallest = child;
+    }  // if-then left child is earlier
+    if (child + 1 < _count && _deadline[_heap[child + 1]] < _deadline[_heap[smallest]]) {
+      smallest = child + 1;
+    }  // if-then right child is earlier
+    if (smallest == position) {
+      break;
+    }  // if-then heap order is correct
+    swap(smallest, position);
+    position = smallest;
+  }  // of while-loop heap order not correct
+}  // of method siftDown()
+void DS3231M_Scheduler::swap(schedulerHandle a, schedulerHandle b) {
+  /*!
+   @brief     swaps two heap entries and updates the position of their handles
+   @param[in] a Heap position
+   @param[in] b Heap position
+  */
+  schedulerHandle handle = _heap[a];
+  _heap[a]               = _heap[b];
+  _heap[b]               = handle;
+  _position[_heap[a]]    = a;
+  _position[_heap[b]]    = b;
+}  // of method swap()
+void DS3231M_Scheduler::removeAt(schedulerHandle position) {
+  /*!
+   @brief     removes a heap entry and frees its handle
+   @param[in] position Heap position
+  */
+  _position[_heap[position]] = DS3231M_SCHEDULER_FULL;
+  if (position != --_count) {
+    _heap[position]            = _heap[_count];  // Move the last entry into the gap
+    _position[_heap[position]] = position;
+    siftDown(position);
+    siftUp(position);
+  }  // if-then not the last entry
+}  // of method removeAt()
+void DS3231M_Scheduler::arm() {
+  /*!
+   @brief     programs alarm 1 with the nearest deadline
+   @details   If the nearest deadline has already been reached then alarm 1 would not trigger until
+              the next month, so the event is marked for dispatch by the next service() call. Only
+              the A1F flag is cleared, so that alarm 2 stays available to the sketch
+  */
+  if (_count == 0) {
+    _rtc->writeAlarm(secondsMinutesHoursDateMatch, DateTime(_armed), false, DS3231M_ALARM1);
+    return;  // Alarm 1 disabled
+  }          // if-then nothing scheduled
+  _armed = _deadline[_heap[0]];
+  _rtc->writeAlarm(secondsMinutesHoursDateMatch, DateTime(_armed), true, DS3231M_ALARM1);
+  if (_armed <= _rtc->now().unixtime()) {
+    _fired = true;  // Already due, dispatch on the next service() call
+  }                 // if-then deadline already reached
+}  // of method arm()
+DS3231M_TemperatureLog::DS3231M_TemperatureLog() {}  ///< Unused class constructor
+void DS3231M_TemperatureLog::add(const uint32_t unixTime, const int32_t temp) {
+  /*!
+   @brief     adds a temperature sample, replacing the oldest one when the log is full
+   @details   The sum, minimum and maximum are updated incrementally. Only when the sample being
+              replaced was the minimum or maximum are the remaining samples searched again
+   @param[in] unixTime UNIX time of the sample
+   @param[in] temp temperature in 1/100 degrees Celsius
+  */
+  bool    rescan = false;
+  uint8_t slot   = (_first + _count) % DS3231M_TEMP_LOG_SIZE;
+  if (_count == DS3231M_TEMP_LOG_SIZE) {
+    int16_t oldest = _temperature[_first];
+    _sum -= oldest;
+    rescan = (oldest == _minimum || oldest == _maximum);
+    _first = (_first + 1) % DS3231M_TEMP_LOG_SIZE;
+  } else {
+    ++_count;
+  }  // if-then-else log full
+  _time[slot]        = unixTime;
+  _temperature[slot] = temp;
+  _sum += temp;
+  if (rescan) {
+    _minimum = _maximum = temp;
+    for (uint8_t i = 0; i < _count; ++i) {
+      int16_t value = _temperature[(_first + i) % DS3231M_TEMP_LOG_SIZE];
+      if (value < _minimum) {
+        _minimum = value;
+      }  // if-then new minimum
+      if (value > _maximum) {
+        _maximum = value;
+      }  // if-then new maximum
+    }    // for-next each sample
+  } else {
+    if (_count == 1 || temp < _minimum) {
+      _minimum = temp;
+    }  // if-then first sample or new minimum
+    if (_count == 1 || temp > _maximum) {
+      _maximum = temp;
+    }  // if-then first sample or new maximum
+  }    // if-then-else min or max was replaced
+}  // of method add()
+uint8_t DS3231M_TemperatureLog::count() {
+  /*!
+   @brief     returns the number of samples in the log
+   @return    number of samples
+  */
+  return _count;
+}  // of method count()
+bool DS3231M_TemperatureLog::sample(const uint8_t index, uint32_t& unixTime, int32_t& temp) {
+  /*!
+   @brief     returns a sample from the log
+   @param[in] index Sample number, 0 is the oldest sample
+   @param[out] unixTime UNIX time of the sample
+   @param[out] temp temperature in 1/100 degrees Celsius
+   @return    false if there is no such sample
+  */
+  if (index >= _count) {
+    return false;
+  }  // if-then out of range
+  uint8_t slot = (_first + index) % DS3231M_TEMP_LOG_SIZE;
+  unixTime     = _time[slot];
+  temp         = _temperature[slot];
+  return true;
+}  // of method sample()
+int32_t DS3231M_TemperatureLog::minimum() {
+  /*!
+   @brief     returns the lowest temperature in the log
+   @return    temperature in 1/100 degrees Celsius, 0 if empty
+  */
+  return _minimum;
+}  // of method minimum()
+int32_t DS3231M_TemperatureLog::maximum() {
+  /*!
+   @brief     returns the highest temperature in the log
+   @return    temperature in 1/100 degrees Celsius, 0 if empty
+  */
+  return _maximum;
+}  // of method maximum()
+int32_t DS3231M_TemperatureLog::mean() {
+  /*!
+   @brief     returns the mean temperature of the log
+   @return    temperature in 1/100 degrees Celsius, 0 if empty
+  */
+  return _count ? _sum / _count : 0;
+}  // of method mean()
+void DS3231M_TemperatureLog::clear() {
+  /*!
+   @brief     removes all samples from the log
+  */
+  _first   = 0;
+  _count   = 0;
+  _sum     = 0;
+  _minimum = 0;
+  _maximum = 0;
+}  // of method clear()
+DS3231M_Calibration::DS3231M_Calibration(DS3231M_Class& rtc, calibrationSource source)
+    : _rtc(&rtc), _source(source) {
+  /*!
+   @brief     Class constructor
+   @param[in] rtc DS3231M_Class instance to calibrate
+   @param[in] source Function returning the reference time, samples can also be added directly
+              with addSample() when no source is given
+  */
+}  // of class constructor
+bool DS3231M_Calibration::sample() {
+  /*!
+   @brief     takes a sample of the reference time, the RTC time and the temperature
+   @details   For millisecond resolution the RTC time base should be active, see timeBase(). The
+              samples are discarded when the clock has been set with adjust() since the last sample
+   @return    false if there is no time source or it returned 0 for "no time available"
+  */
+  if (_source == nullptr) {
+    return false;
+  }  // if-then no source
+  uint16_t refMillis;
+  uint32_t refTime = _source(refMillis);
+  if (refTime == 0) {
+    return false;
+  }  // if-then source has no time
+  uint16_t rtcMillis;
+  uint32_t rtcTime = _rtc->now(rtcMillis).unixtime();
+  addSample(refTime, refMillis, rtcTime, rtcMillis, _rtc->temperature());
+  return true;
+}  // of method sample()
+void DS3231M_Calibration::addSample(const uint32_t refTime, const uint16_t refMillis,
+                                    const uint32_t rtcTime, const uint16_t rtcMillis,
+                                    const int32_t temp) {
+  /*!
+   @brief     adds a sample to the drift fit
+   @details   Only the last DS3231M_CAL_SAMPLES samples are used in the fit
+   @param[in] refTime Reference UNIX time
+   @param[in] refMillis Milliseconds of the reference time
+   @param[in] rtcTime RTC UNIX time at the same moment
+   @param[in] rtcMillis Milliseconds of the RTC time
+   @param[in] temp Temperature in 1/100 degrees Celsius
+  */
+  if (_rtc->lastSet() != _setTime) {
+    reset();  // Clock was set, earlier samples no longer apply
+  }           // if-then clock set
+  if (_count == 0) {
+    _origin  = refTime;
+    _setTime = _rtc->lastSet();
+  }  // if-then first sample
+  _elapsed[_next] = refTime - _origin;
+  _error[_next] = (int32_t)(rtcTime - refTime) * 1000 + ((int32_t)rtcMillis - (int32_t)refMillis);
+  _temperature[_next] = temp;
+  _next               = (_next + 1) % DS3231M_CAL_SAMPLES;
+  if (_count < DS3231M_CAL_SAMPLES) {
+    ++_count;
+  }  // if-then not full
+}  // of method addSample()
+uint8_t DS3231M_Calibration::samples() {
+  /*!
+   @brief     returns the number of samples in the fit
+   @return    number of samples
+  */
+  return _count;
+}  // of method samples()
+bool DS3231M_Calibration::drift(int32_t& ppm) {
+  /*!
+   @brief     returns the drift of the RTC fitted over the samples
+   @details   The slope of the time error against the elapsed reference time is computed as
+              Sxy/Sxx with the sums taken about the means, which keeps single precision floating
+              point accurate over long calibration periods. Positive values mean the RTC is fast
+   @param[out] ppm Drift in 1/100 ppm, only set when the fit is possible
+   @return    false if there are fewer than 3 samples or they were all taken at the same time
+  */
+  if (_count < 3) {
+    return false;
+  }  // if-then too few samples
+  float meanX = 0, meanY = 0;
+  for (uint8_t i = 0; i < _count; ++i) {
+    meanX += _elapsed[i];
+    meanY += _error[i];
+  }  // for-next each sample
+  meanX /= _count;
+  meanY /= _count;
+  float sxx = 0, sxy = 0;
+  for (uint8_t i = 0; i < _count; ++i) {
+    float dx = _elapsed[i] - meanX;
+    sxx += dx * dx;
+    sxy += dx * (_error[i] - meanY);
+  }  // for-next each sample
+  if (sxx < 1) {
+    return false;
+  }  // if-then no time span
+  float slope = sxy / sxx * 100000.0f;  // ms per second to 1/100 ppm
+  ppm         = slope < 0 ? (int32_t)(slope - 0.5f) : (int32_t)(slope + 0.5f);
+  return true;
+}  // of method drift()
+int8_t DS3231M_Calibration::calibrate() {
+  /*!
+   @brief     corrects the aging offset for the fitted drift
+   @details   The drift is rounded to the nearest 0.12ppm aging offset step, positive offsets slow
+              the RTC down. The new offset is stored in the temperature table under the mean
+              temperature of the samples and the samples are discarded, as they were taken with the
+              old offset. Nothing is changed and the samples are kept when the current offset
+              can't be read, as the new offset is computed from it
+   @return    the new aging offset, the unchanged offset if there was no fit, 0 if the offset
+              could not be read
+  */
+  int8_t current;
+  if (!_rtc->getAgingOffset(current)) {
+    return 0;
+  }  // if-then aging offset read failed
+  int32_t ppm;
+  int32_t offset = current;
+  if (!drift(ppm)) {
+    return offset;
+  }  // if-then no fit
+  int32_t half = ppm < 0 ? -(DS3231M_AGING_STEP / 2) : DS3231M_AGING_STEP / 2;
+  offset += (ppm + half) / DS3231M_AGING_STEP;  // Round to the nearest step
+  if (offset > 127) {
+    offset = 127;
+  } else if (offset < -128) {
+    offset = -128;
+  }  // if-then-else offset out of range
+  _rtc->setAgingOffset(offset);
+  int32_t temp = 0;
+  for (uint8_t i = 0; i < _count; ++i) {
+    temp += _temperature[i];
+  }  // for-next each sample
+  uint8_t index = bin(temp / _count);
+  _table[index] = offset;
+  _tableValid |= 1 << index;
+  reset();
+  return offset;
+}  // of method calibrate()
+bool DS3231M_Calibration::compensate() {
+  /*!
+   @brief     sets the aging offset calibrated for the current temperature
+   @details   Only bins filled by calibrate() are used, the offset is left unchanged otherwise
+   @return    true if the table had an offset for the current temperature
+  */
+  uint8_t index = bin(_rtc->temperature());
+  if (!(_tableValid & (1 << index))) {
+    return false;
+  }  // if-then bin empty
+  if (_rtc->getAgingOffset() != _table[index]) {
+    _rtc->setAgingOffset(_table[index]);
+    reset();  // Samples taken with the old offset
+  }           // if-then offset changes
+  return true;
+}  // of method compensate()
+void DS3231M_Calibration::reset() {
+  /*!
+   @brief     discards all samples, the temperature table is kept
+  */
+  _next  = 0;
+  _count = 0;
+}  // of method reset()
+uint8_t DS3231M_Calibration::bin(const int32_t temp) {
+  /*!
+   @brief     returns the temperature table bin of a temperature
+   @param[in] temp Temperature in 1/100 degrees Celsius
+   @return    bin number, temperatures outside the table use the first or last bin
+  */
+  if (temp < DS3231M_CAL_BIN_FIRST) {
+    return 0;
+  }  // if-then below table
+  uint32_t index = (temp - DS3231M_CAL_BIN_FIRST) / DS3231M_CAL_BIN_WIDTH;
+  return index >= DS3231M_CAL_BINS ? DS3231M_CAL_BINS - 1 : index;
+}  // of method bin()
+DS3231M_Group::DS3231M_Group() {}  ///< Unused class constructor
+uint8_t DS3231M_Group::add(DS3231M_Class& rtc) {
+  /*!
+   @brief     adds an RTC to the group
+   @details   The RTC's begin() method needs to be called separately
+   @param[in] rtc DS3231M_Class instance, the instances can be on different buses
+   @return    index of the RTC in the group, DS3231M_GROUP_SIZE if the group is full
+  */
+  if (_count == DS3231M_GROUP_SIZE) {
+    return DS3231M_GROUP_SIZE;
+  }  // if-then group full
+  _rtc[_count] = &rtc;
+  return _count++;
+}  // of method add()
+uint8_t DS3231M_Group::devices() {
+  /*!
+   @brief     returns the number of RTCs in the group
+   @return    number of RTCs
+  */
+  return _count;
+}  // of method devices()
+uint8_t DS3231M_Group::poll() {
+  /*!
+   @brief     reads the time of all the RTCs in one pass
+   @details   The register pointer of every RTC is set to RTCSEC first, then the time registers of
+              all RTCs are read one after the other without any other transactions in between
+   @return    bit mask of the RTCs that were read successfully, bit 0 is the first RTC added
+  */
+  uint8_t addressed = 0;
+  for (uint8_t i = 0; i < _count; ++i) {
+    DS3231M_Class* rtc = _rtc[i];
+    ++rtc->_readCount;  // Count the read transaction
+    rtc->_TransmissionStatus = rtc->_bus->write(rtc->_address, DS3231M_RTCSEC, nullptr, 0);
+    if (rtc->_TransmissionStatus == 0) {
+      addressed |= 1 << i;
+    }  // if-then device answered
+  }    // for-next each RTC
+  uint8_t buffer[DS3231M_GROUP_SIZE][7];
+  _valid = 0;
+  for (uint8_t i = 0; i < _count; ++i) {
+    if (!(addressed & (1 << i))) {
+      continue;  // Device did not answer
+    }            // if-then not addressed
+#if DS3231M_INSTRUMENTATION
+    uint32_t startMicros = micros();
+#endif
+    uint8_t bytesRead = _rtc[i]->_bus->read(_rtc[i]->_address, buffer[i], 7);
+#if DS3231M_INSTRUMENTATION
+    _rtc[i]->record(DS3231M_RTCSEC, false, 7, bytesRead, startMicros);
+#endif
+    if (bytesRead == 7) {
+      _valid |= 1 << i;
+    }  // if-then read successfully
+  }    // for-next each RTC
+  for (uint8_t i = 0; i < _count; ++i) {
+    if (_valid & (1 << i)) {
+      _time[i] = _rtc[i]->decodeClock(buffer[i]).unixtime();  // Decode after all the reads
+    }                                                         // if-then valid
+  }                                                           // for-next each RTC
+  return _valid;
+}  // of method poll()
+DateTime DS3231M_Group::time(const uint8_t index) {
+  /*!
+   @brief     returns the time of an RTC read by the last poll()
+   @param[in] index Index returned by add()
+   @return    Date/Time, 2000-01-01 00:00:00 if the RTC could not be read
+  */
+  if (index >= _count || !(_valid & (1 << index))) {
+    return DateTime(SECONDS_FROM_1970_TO_2000);
+  }  // if-then not read
+  return DateTime(_time[index]);
+}  // of method time()
+uint32_t DS3231M_Group::spread() {
+  /*!
+   @brief     returns the difference between the earliest and the latest RTC of the last poll()
+   @details   Only the RTCs that were read successfully are compared
+   @return    spread in seconds, 0 if fewer than 2 RTCs were read
+  */
+  uint32_t earliest = 0xFFFFFFFF, latest = 0;
+  for (uint8_t i = 0; i < _count; ++i) {
+    if (_valid & (1 << i)) {
+      if (_time[i] < earliest) {
+        earliest = _time[i];
+      }  // if-then earliest so far
+      if (_time[i] > latest) {
+        latest = _time[i];
+      }  // if-then latest so far
+    }    // if-then valid
+  }      // for-next each RTC
+  return latest > earliest ? latest - earliest : 0;
+}  // of method spread()
+DS3231M_EventLog::DS3231M_EventLog(DS3231M_Class& rtc) : _rtc(&rtc) {}  ///< Class constructor
+bool DS3231M_EventLog::begin(const uint8_t rate) {
+  /*!
+   @brief     starts the square wave on INT/SQW and anchors the edge count to the RTC time
+   @details   The interrupt routine calling edge() needs to be attached to the INT/SQW pin before
+              this is called. The resolution of the records is 16us at 1Hz, where the offset from
+              the edge can be up to a second, and 1us at the kHz rates of the DS3231
+   @param[in] rate Square wave rate code, see pinSquareWave(), only 0 (1Hz) on the DS3231M
+   @return    true if the anchor could be set
+  */
+  static const uint16_t rates[] = {1, 1024, 4096, 8192};
+  _rate                         = rates[rate & 0x03];
+  _shift                        = (_rate == 1) ? 4 : 0;
+  _rtc->pinSquareWave(rate);
+  return anchor();
+}  // of method begin()
+bool DS3231M_EventLog::anchor() {
+  /*!
+   @brief     aligns the edge count with the RTC seconds
+   @details   The time registers are read until the seconds change, taking up to 1 second. At 1Hz
+              the falling edge coincides with the change, so the anchor is exact. At the higher
+              rates it is accurate to within the duration of one I2C read. Calling this
+              periodically also corrects for missed edges
+   @return    false if the seconds did not change within DS3231M_EDGE_TIMEOUT milliseconds
+  */
+  DateTime dt;
+  if (!_rtc->readTime(dt)) {
+    return false;
+  }  // if-then read failed
+  uint32_t first = dt.unixtime();
+  uint32_t start = millis();
+  while (millis() - start < DS3231M_EDGE_TIMEOUT) {
+    noInterrupts();  // Copy the ISR-updated value atomically
+    uint32_t before = _edgeCount;
+    interrupts();
+    bool ok = _rtc->readTime(dt, 0);
+    noInterrupts();
+    uint32_t after = _edgeCount;
+    interrupts();
+    if (ok && dt.unixtime() != first) {
+      _anchorUnix = dt.unixtime();
+      _anchorEdge = (_rate == 1) ? after : before;  // The 1Hz edge came before the read
+      return true;
+    }  // if-then seconds changed
+  }    // of while-loop waiting for the seconds to change
+  return false;
+}  // of method anchor()
+void DS3231M_EventLog::edge() {
+  /*!
+   @brief     counts a falling edge of the INT/SQW square wave
+   @details   Call from the interrupt routine attached to the INT/SQW pin, no I2C traffic is done
+  */
+  _edgeMicros = micros();
+  ++_edgeCount;
+}  // of method edge()
+void DS3231M_EventLog::capture(const uint8_t channel) {
+  /*!
+   @brief     records an event
+   @details   Call from the interrupt routine of the event input, no I2C traffic is done. This is
+              the only writer of the ring buffer, the record is complete before the head index
+              that publishes it is stored. When the buffer is full the event is counted in
+              dropped() instead
+   @param[in] channel Number identifying the event source
+  */
+  uint32_t elapsed = micros() - _edgeMicros;
+  uint8_t  head    = _head;
+  uint8_t  next    = (head + 1) & (DS3231M_EVENT_QUEUE - 1);
+  if (next == _tail) {
+    ++_dropped;
+    return;
+  }  // if-then buffer full
+  elapsed >>= _shift;
+  _edge[head]    = _edgeCount;
+  _offset[head]  = elapsed > 0xFFFF ? 0xFFFF : elapsed;
+  _channel[head] = channel;
+  _head          = next;  // Publish the record
+}  // of method capture()
+uint8_t DS3231M_EventLog::available() {
+  /*!
+   @brief     returns the number of records waiting to be read
+   @return    number of records
+  */
+  return (_head - _tail) & (DS3231M_EVENT_QUEUE - 1);
+}  // of method available()
+bool DS3231M_EventLog::read(DS3231M_Event& event) {
+  /*!
+   @brief     removes the oldest record from the ring buffer
+   @details   Call from the main loop, this is the only reader of the ring buffer
+   @param[out] event The record
+   @return    false if there are no records
+  */
+  uint8_t tail = _tail;
+  if (tail == _head) {
+    return false;
+  }  // if-then empty
+  event.edge    = _edge[tail];
+  event.offset  = _offset[tail];
+  event.channel = _channel[tail];
+  _tail         = (tail + 1) & (DS3231M_EVENT_QUEUE - 1);  // Free the slot
+  return true;
+}  // of method read()
+uint16_t DS3231M_EventLog::dropped() {
+  /*!
+   @brief     returns the number of events lost because the ring buffer was full
+   @return    number of events
+  */
+  return _dropped;
+}  // of method dropped()
+DateTime DS3231M_EventLog::time(const DS3231M_Event& event, uint32_t& microseconds) {
+  /*!
+   @brief     converts a record to an absolute date/time
+   @details   Records taken before the current anchor return the anchor time
+   @param[in] event Record returned by read()
+   @param[out] microseconds Microseconds within the second (0-999999)
+   @return    Date/Time of the event
+  */
+  uint32_t edges = event.edge - _anchorEdge;
+  if (edges > 0x7FFFFFFF) {
+    microseconds = 0;
+    return DateTime(_anchorUnix);
+  }  // if-then before the anchor
+  uint32_t seconds   = edges / _rate;
+  uint32_t remainder = edges - seconds * _rate;  // Edges within the second
+  microseconds = (_rate == 1) ? 0 : remainder * 15625 / (_rate >> 6);  // 10^6 = 15625 * 64
+  microseconds += (uint32_t)event.offset << _shift;
+  seconds += microseconds / 1000000;
+  microseconds %= 1000000;
+  return DateTime(_anchorUnix + seconds);
+}  // of method time()
+const DS3231M_Zone DS3231M_ZONE_UTC PROGMEM         = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+const DS3231M_Zone DS3231M_ZONE_LONDON PROGMEM      = {0, 60, 3, 5, 0, 1, 10, 5, 0, 2};
+const DS3231M_Zone DS3231M_ZONE_BERLIN PROGMEM      = {60, 60, 3, 5, 0, 2, 10, 5, 0, 3};
+const DS3231M_Zone DS3231M_ZONE_NEW_YORK PROGMEM    = {-300, 60, 3, 2, 0, 2, 11, 1, 0, 2};
+const DS3231M_Zone DS3231M_ZONE_CHICAGO PROGMEM     = {-360, 60, 3, 2, 0, 2, 11, 1, 0, 2};
+const DS3231M_Zone DS3231M_ZONE_DENVER PROGMEM      = {-420, 60, 3, 2, 0, 2, 11, 1, 0, 2};
+const DS3231M_Zone DS3231M_ZONE_LOS_ANGELES PROGMEM = {-480, 60, 3, 2, 0, 2, 11, 1, 0, 2};
+const DS3231M_Zone DS3231M_ZONE_SYDNEY PROGMEM      = {600, 60, 10, 1, 0, 2, 4, 1, 0, 3};
+const DS3231M_Zone DS3231M_ZONE_KOLKATA PROGMEM     = {330, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+const DS3231M_Zone DS3231M_ZONE_TOKYO PROGMEM       = {540, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+DS3231M_TimeZone::DS3231M_TimeZone(const DS3231M_Zone* zone) {
+  /*!
+   @brief     Class constructor
+   @param[in] zone Zone rule in PROGMEM, e.g. &DS3231M_ZONE_BERLIN
+  */
+  this->zone(zone);
+}  // of constructor
+void DS3231M_TimeZone::zone(const DS3231M_Zone* zone) {
+  /*!
+   @brief     changes the zone rule
+   @param[in] zone Zone rule in PROGMEM
+  */
+  memcpy_P(&_zone, zone, sizeof(_zone));
+  _yearStart = _yearEnd = 0;  // Recompute the transitions on the next lookup
+}  // of method zone()
+uint32_t DS3231M_TimeZone::transition(const uint16_t year, const uint8_t month, const uint8_t week,
+                                      const uint8_t weekday, const uint8_t hour,
+                                      const int16_t offset) {
+  /*!
+   @brief     computes the UTC time of a daylight saving time transition
+   @param[in] year Year
+   @param[in] month Month
+   @param[in] week Week of the month, 5 for the last
+   @param[in] weekday Weekday, Sunday = 0
+   @param[in] hour Local hour of the transition
+   @param[in] offset Offset east of UTC in minutes in effect before the transition
+   @return    UNIX time of the transition
+  */
+  uint16_t first = DateTime::date2days(year, month, 1);  // Days since 2000-01-01
+  uint8_t  firstWeekday = (first + 6) % 7;                // Jan 1, 2000 is a Saturday
+  uint16_t day          = first + (weekday + 7 - firstWeekday) % 7 + 7 * (week - 1);
+  uint8_t  length       = DateTime::daysInMonth(year, month);
+  if (day >= first + length) {
+    day -= 7;
+  }  // if-then no 5th weekday, use the last one
+  return day * SECONDS_PER_DAY + hour * 3600UL - (int32_t)offset * 60 + SECONDS_FROM_1970_TO_2000;
+}  // of method transition()
+void DS3231M_TimeZone::load(const uint32_t utc) {
+  /*!
+   @brief     computes the year boundaries and daylight saving time transitions of a year
+   @param[in] utc UNIX time within the year
+  */
+  uint16_t year = DateTime(utc).year();
+  _yearStart = DateTime::date2days(year, 1, 1) * SECONDS_PER_DAY + SECONDS_FROM_1970_TO_2000;
+  _yearEnd   = DateTime::date2days(year + 1, 1, 1) * SECONDS_PER_DAY + SECONDS_FROM_1970_TO_2000;
+  if (_zone.dst) {
+    _dstStart = transition(year, _zone.startMonth, _zone.startWeek, _zone.startWeekday,
+                           _zone.startHour, _zone.standard);
+    _dstEnd   = transition(year, _zone.endMonth, _zone.endWeek, _zone.endWeekday, _zone.endHour,
+                           _zone.standard + _zone.dst);
+  }  // if-then zone has daylight saving time
+}  // of method load()
+bool DS3231M_TimeZone::isDst(const uint32_t utc) {
+  /*!
+   @brief     returns whether daylight saving time is in effect
+   @details   The unsigned differences make this a single comparison for zones on both
+              hemispheres, i.e. also when daylight saving time spans the new year
+   @param[in] utc UNIX time
+   @return    true during daylight saving time
+  */
+  if (!_zone.dst) {
+    return false;
+  }  // if-then no daylight saving time
+  if (utc - _yearStart >= _yearEnd - _yearStart) {
+    load(utc);
+  }  // if-then not in the cached year
+  return utc - _dstStart < _dstEnd - _dstStart;
+}  // of method isDst()
+int16_t DS3231M_TimeZone::offset(const uint32_t utc) {
+  /*!
+   @brief     returns the offset of the local time
+   @param[in] utc UNIX time
+   @return    Offset east of UTC in minutes
+  */
+  return _zone.standard + (isDst(utc) ? _zone.dst : 0);
+}  // of method offset()
+uint32_t DS3231M_TimeZone::toLocal(const uint32_t utc) {
+  /*!
+   @brief     converts UTC to local time
+   @param[in] utc UNIX time
+   @return    Local time as seconds since 1970-01-01 00:00:00 local time
+  */
+  return utc + (int32_t)offset(utc) * 60;
+}  // of method toLocal()
+uint32_t DS3231M_TimeZone::toUtc(const uint32_t local) {
+  /*!
+   @brief     converts local time to UTC
+   @details   The transitions are looked up for the local time taken as standard time, so that the
+              repeated hour at the end of daylight saving time is standard time and times in the
+              hour skipped at the start are moved back by the daylight saving time offset
+   @param[in] local Local time as seconds since 1970-01-01 00:00:00 local time
+   @return    UNIX time
+  */
+  return local - (int32_t)offset(local - (int32_t)_zone.standard * 60) * 60;
+}  // of method toUtc()
+DateTime DS3231M_TimeZone::toLocal(const DateTime& utc) {
+  /*!
+   @brief     converts a UTC date/time to local date/time
+   @param[in] utc UTC date/time
+   @return    Local date/time
+  */
+  return DateTime(toLocal(utc.unixtime()));
+}  // of method toLocal()
+DateTime DS3231M_TimeZone::toUtc(const DateTime& local) {
+  /*!
+   @brief     converts a local date/time to UTC date/time
+   @param[in] local Local date/time
+   @return    UTC date/time
+  */
+  return DateTime(toUtc(local.unixtime()));
+}  // of method toUtc()
+DS3231M_SharedTime::DS3231M_SharedTime(DS3231M_Class& rtc) : _rtc(&rtc) {}  ///< Class constructor
+bool DS3231M_SharedTime::refresh() {
+  /*!
+   @brief     reads the time and temperature and publishes them to the readers
+   @details   Must only be called by the one task that owns the I2C bus. The values are read before
+              the sequence number is changed, so the readers are only held up while they are
+              copied. When the time base of the RTC is active (see timeBase()) the time and its
+              sub-second phase are taken from it, otherwise the time is read with readTime() and
+              the phase is unknown, so the published time then lags the RTC by up to 1 second.
+              Only a complete and valid read is published
+   @return    false if the RTC could not be read, the previous values stay published
+  */
+  DateTime dt;
+  uint16_t phase = 0;  // Milliseconds since the RTC second of "dt" started
+  if (!_rtc->timeBaseRead(dt, phase) && !_rtc->readTime(dt)) {
+    return false;
+  }  // if-then time read failed
+  uint32_t start = millis() - phase;  // millis() when the second of "dt" started
+  int32_t  temperature;
+  if (!_rtc->temperature(temperature)) {
+    return false;
+  }  // if-then temperature read failed
+  uint32_t sequence = __atomic_load_n(&_sequence, __ATOMIC_RELAXED) + 1;  // Odd while changing
+  __atomic_store_n(&_sequence, sequence, __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_RELEASE);  // The odd number is visible before the values change
+  __atomic_store_n(&_unixTime, dt.unixtime(), __ATOMIC_RELAXED);
+  __atomic_store_n(&_millis, start, __ATOMIC_RELAXED);
+  __atomic_store_n(&_temperature, temperature, __ATOMIC_RELAXED);
+  __atomic_store_n(&_sequence, sequence + 1, __ATOMIC_RELEASE);  // Values visible before this
+  return true;
+}  // of method refresh()
+bool DS3231M_SharedTime::read(uint32_t& unixTime, uint16_t& milliseconds, int32_t& temperature) {
+  /*!
+   @brief     copies the published values, all from the same refresh()
+   @details   Safe to call from any number of tasks on any core at the same time as refresh()
+   @param[out] unixTime UNIX time at the refresh, advanced by the millis() elapsed since
+   @param[out] milliseconds Milliseconds within the second (0-999). This is the phase of the RTC
+               second when refresh() used the time base of the RTC, otherwise it is counted from
+               the refresh() read
+   @param[out] temperature Temperature in 1/100 degrees Celsius
+   @return    false if nothing has been published yet
+  */
+  uint32_t before, after, stamp;
+  for (;;) {
+    before      = __atomic_load_n(&_sequence, __ATOMIC_ACQUIRE);  // Before the values
+    unixTime    = __atomic_load_n(&_unixTime, __ATOMIC_RELAXED);
+    stamp       = __atomic_load_n(&_millis, __ATOMIC_RELAXED);
+    temperature = __atomic_load_n(&_temperature, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);  // The values are read before the number is checked
+    after = __atomic_load_n(&_sequence, __ATOMIC_RELAXED);
+    if (before == after && !(before & 1)) {
+      break;
+    }  // if-then consistent copy
+    __atomic_fetch_add(&_retries, 1, __ATOMIC_RELAXED);
+  }  // of for-ever until the copy is consistent
+  uint32_t elapsed = millis() - stamp;  // Advance to the current time
+  unixTime += elapsed / 1000;
+  milliseconds = elapsed % 1000;
+  return before != 0;
+}  // of method read()
+DateTime DS3231M_SharedTime::now() {
+  /*!
+   @brief     returns the current date/time from the published values
+   @return    Current Date/Time, 2000-01-01 00:00:00 if nothing has been published yet
+  */
+  uint32_t unixTime;
+  uint16_t milliseconds;
+  int32_t  temperature;
+  if (!read(unixTime, milliseconds, temperature)) {
+    return DateTime(SECONDS_FROM_1970_TO_2000);
+  }  // if-then nothing published
+  return DateTime(unixTime);
+}  // of method now()
+int32_t DS3231M_SharedTime::temperature() {
+  /*!
+   @brief     returns the published temperature
+   @return    Temperature in 1/100 degrees Celsius, 0 if nothing has been published yet
+  */
+  uint32_t unixTime;
+  uint16_t milliseconds;
+  int32_t  temperature;
+  read(unixTime, milliseconds, temperature);
+  return temperature;
+}  // of method temperature()
+uint32_t DS3231M_SharedTime::retries() {
+  /*!
+   @brief     returns how often a reader had to repeat its copy because refresh() was running
+   @return    Number of repeated copies
+  */
+  return __atomic_load_n(&_retries, __ATOMIC_RELAXED);
+}  // of method retries()
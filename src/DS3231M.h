@@ -23,6 +23,15 @@
  when pushing to GitHub. The local file, if present in the root directory, is ignored when
  committing and uploading.
 
+ @section portability Portability
+ The library only uses the "Arduino.h" integer types, the PROGMEM/pgm_read_word()/memcpy_P() flash
+ access macros, F() and the "Wire" I2C object. No other Arduino specific definitions such as the
+ binary "B00000000" constants are used, so the sources can be compiled natively against minimal
+ replacements of "Arduino.h" and "Wire.h", e.g. to run the library against a simulated device.
+ "Wire" is only the default bus, the DS3231M_Class constructor accepts any DS3231M_Bus, either a
+ DS3231M_WireBus adapter for another "Wire" compatible object or a direct implementation such as a
+ simulated device, along with the device address.
+
  @section license GNU General Public License v3.0
 
  This program is free software: you can redistribute it and/or modify it under the terms of the GNU
@@ -41,6 +50,30 @@
 
  Version| Date       | Developer     | Comments
  ------ | ---------- | ------------- | --------
+ 1.1.0  | 2026-10-17 | SV-Zanshin    | Added DS3231M_SharedTime, sequence locked multi-core access
+ 1.1.0  | 2026-10-17 | SV-Zanshin    | Added serviceAlarms(), isAlarm() checks both alarms
+ 1.1.0  | 2026-10-17 | SV-Zanshin    | DateTime +=/-= and field carry for spans within a month
+ 1.1.0  | 2026-10-17 | SV-Zanshin    | Added DS3231M_TimeZone with PROGMEM zone rules and DST cache
+ 1.1.0  | 2026-10-17 | SV-Zanshin    | Added DateTime toString() and parse() without printf/scanf
+ 1.1.0  | 2026-10-17 | SV-Zanshin    | Added DS3231M_EventLog interrupt event timestamping
+ 1.1.0  | 2026-10-17 | SV-Zanshin    | Added snapshot() to read all registers in one burst
+ 1.1.0  | 2026-10-17 | SV-Zanshin    | Added readTime() with validation and bounded retries
+ 1.1.0  | 2026-10-17 | SV-Zanshin    | Optional I2C statistics with DS3231M_INSTRUMENTATION
+ 1.1.0  | 2026-10-17 | SV-Zanshin    | Added 4 byte PackedDateTime with lazy field decoding
+ 1.1.0  | 2026-10-17 | SV-Zanshin    | Register bit fields as constexpr descriptors, coalesced
+ 1.1.0  | 2026-10-17 | SV-Zanshin    | Injectable I2C bus and address, added DS3231M_Group
+ 1.1.0  | 2026-10-17 | SV-Zanshin    | Added DS3231M_Calibration aging offset calibration
+ 1.1.0  | 2026-10-17 | SV-Zanshin    | Burst temperature read, forced conversion and temperature log
+ 1.1.0  | 2026-10-17 | SV-Zanshin    | Added DS3231M_Scheduler timer multiplexer using alarm 1
+ 1.1.0  | 2026-10-17 | SV-Zanshin    | Added non-blocking queued time, temperature and status reads
+ 1.1.0  | 2026-10-17 | SV-Zanshin    | DateTime and TimeSpan made constexpr, compile time constant
+ 1.1.0  | 2026-10-17 | SV-Zanshin    | Added batch structure-of-arrays UNIX time conversions
+ 1.1.0  | 2026-10-17 | SV-Zanshin    | Removed Arduino binary constants to allow native compiling
+ 1.1.0  | 2026-10-17 | SV-Zanshin    | Closed-form date conversions without year and month loops
+ 1.1.0  | 2026-10-17 | SV-Zanshin    | Added interpolated time base for now() with 1Hz edge sync
+ 1.1.0  | 2026-10-17 | SV-Zanshin    | setAlarm() computes the alarm registers and writes in a burst
+ 1.1.0  | 2026-10-17 | SV-Zanshin    | Added register shadow copy and I2C transaction counters
+ 1.1.0  | 2026-10-17 | SV-Zanshin    | adjust() writes the time registers in one burst transaction
  1.0.11 | 2023-06-14 | capitainekurck| Issue #24 - IsAlarm() ignores status bits
  1.0.10 | 2023-05-03 | capitainekurck| Issue #23 - Corrected formula for leap year calculation
  1.0.9  | 2022-06-29 | Levent-Keskin | Issue #22 - Corrected formula for DOW calculation for #22
@@ -67,6 +100,20 @@
 #ifndef DS3231M_h
   /*! @brief Guard code definition to prevent multiple definitions */
   #define DS3231M_h
+  #ifndef DS3231M_INSTRUMENTATION
+    /*! @brief Set to 1 to keep I2C statistics, see statistics(). This changes the class layout,
+               so it must be set as a compiler flag ("-DDS3231M_INSTRUMENTATION=1") which applies
+               to both the library and the sketch */
+    #define DS3231M_INSTRUMENTATION 0
+  #endif
+  #ifndef DS3231M_SCHEDULER_SIZE
+    /*! @brief Maximum number of events of a DS3231M_Scheduler, 1 to 65534. Each event takes a 4
+               byte deadline, a callback pointer and 2 handles, 8 bytes of RAM on AVR. Handles are
+               1 byte up to 254 events and 2 bytes above, which makes it 10 bytes per event. This
+               changes the class layout, so it must be set as a compiler flag
+               ("-DDS3231M_SCHEDULER_SIZE=300") which applies to both the library and the sketch */
+    #define DS3231M_SCHEDULER_SIZE 16
+  #endif
 
 /**************************************************************************************************
 ** Declare enumerated types                                                                      **
@@ -86,6 +133,43 @@ enum alarmTypes {
   minutesHoursDayMatch,
   UnknownAlarm
 };
+/*! @brief Declare the enumerated type for the non-blocking requests, see requestAsync() */
+enum asyncRequestTypes { timeRequest, temperatureRequest, statusRequest, UnknownRequest };
+/*! @brief Declare the enumerated type for the I2C statistics, by registers and direction */
+enum busOperations {
+  timeRead,
+  timeWrite,
+  alarmRead,
+  alarmWrite,
+  controlRead,
+  controlWrite,
+  agingRead,
+  agingWrite,
+  temperatureRead,
+  temperatureWrite,
+  busOperationCount
+};
+/*! @brief Declare the enumerated type for the text formats of DateTime toString() and parse() */
+enum dateTimeFormats {
+  isoFormat,       ///< ISO-8601 extended format "YYYY-MM-DDThh:mm:ss"
+  isoSpaceFormat,  ///< ISO-8601 extended format with a space, "YYYY-MM-DD hh:mm:ss"
+  compactFormat    ///< ISO-8601 basic format "YYYYMMDDThhmmss"
+};
+/*! @brief Declare the enumerated type for the results of DateTime::parse() */
+enum parseResults { parseOk, parseSyntax, parseRange };
+/*! @brief Completion callback for non-blocking requests, called with the asyncRequestTypes value */
+typedef void (*asyncCallback)(const uint8_t requestType);
+  #if DS3231M_SCHEDULER_SIZE < 255
+/*! @brief Handle of a scheduled event, wide enough for DS3231M_SCHEDULER_SIZE events */
+typedef uint8_t schedulerHandle;
+  #else
+/*! @brief Handle of a scheduled event, wide enough for DS3231M_SCHEDULER_SIZE events */
+typedef uint16_t schedulerHandle;
+  #endif
+/*! @brief Callback for scheduled events, called with the event handle returned by add() */
+typedef void (*schedulerCallback)(const schedulerHandle handle);
+/*! @brief Reference time source for calibration, returns UNIX time and sets the milliseconds */
+typedef uint32_t (*calibrationSource)(uint16_t& milliseconds);
 
 /**************************************************************************************************
 ** Declare classes used in within the class                                                      **
@@ -103,6 +187,25 @@ const uint32_t I2C_FAST_MODE     = 400000;  ///< Fast mode with 400KHz
   #endif
 const uint32_t SECONDS_PER_DAY           = 86400;      ///< 60 secs * 60 mins * 24 hours
 const uint32_t SECONDS_FROM_1970_TO_2000 = 946684800;  ///< Seconds between 1970/1/1 to 2000/1/1
+const uint16_t DS3231M_MCU_TOLERANCE_PPM = 5000;       ///< Assumed MCU clock tolerance, resonator
+const uint16_t DS3231M_EDGE_TIMEOUT      = 1100;       ///< ms without 1Hz edge before fallback
+const uint8_t  DS3231M_ASYNC_QUEUE       = 4;          ///< Number of queued async requests
+const schedulerHandle DS3231M_SCHEDULER_FULL = (schedulerHandle)~0;  ///< add() found no space
+const uint8_t  DS3231M_TEMP_LOG_SIZE     = 16;         ///< Number of samples in the log
+const uint8_t  DS3231M_CAL_SAMPLES       = 8;          ///< Reference samples in the drift fit
+const uint8_t  DS3231M_CAL_BINS          = 8;          ///< Temperature bins in correction table
+const int16_t  DS3231M_CAL_BIN_FIRST     = -2000;      ///< Lowest bin, 1/100 degrees Celsius
+const int16_t  DS3231M_CAL_BIN_WIDTH     = 1000;       ///< Width of each bin, 1/100 degrees C
+const uint8_t  DS3231M_AGING_STEP        = 12;         ///< Aging offset LSB in 1/100 ppm
+const uint8_t  DS3231M_GROUP_SIZE        = 4;          ///< Maximum RTCs in a DS3231M_Group
+const uint8_t  DS3231M_READ_RETRIES      = 3;          ///< Retries of readTime() after a failure
+const uint16_t DS3231M_RETRY_DELAY       = 100;        ///< First retry delay in us, then doubled
+const uint16_t DS3231M_RETRY_DELAY_MAX   = 12800;      ///< Longest retry delay in us
+const uint8_t  DS3231M_REGISTERS         = 0x13;       ///< Number of registers, 0x00 to 0x12
+const uint8_t  DS3231M_EVENT_QUEUE       = 16;         ///< Event records, must be a power of 2
+const uint8_t  DS3231M_DATE_TIME_SIZE    = 20;         ///< toString() buffer size for isoFormat
+const uint8_t  DS3231M_ALARM1            = 0x01;       ///< serviceAlarms() bit for alarm 1
+const uint8_t  DS3231M_ALARM2            = 0x02;       ///< serviceAlarms() bit for alarm 2
 const uint8_t  DS3231M_ADDRESS           = 0x68;       ///< Fixed I2C Address for DS3231M
 const uint8_t  DS3231M_RTCSEC            = 0x00;       ///< DS3231 RTCSEC      Register Address
 const uint8_t  DS3231M_RTCMIN            = 0x01;       ///< DS3231 RTCMIN      Register Address
@@ -123,33 +226,234 @@ const uint8_t  DS3231M_STATUS            = 0x0F;       ///< DS3231 STATUS      R
 const uint8_t  DS3231M_AGING             = 0x10;       ///< DS3231 AGING       Register Address
 const uint8_t  DS3231M_TEMPERATURE       = 0x11;       ///< DS3231 TEMPERATURE Register Address
 
+/*!
+ @brief    A change to one or more bit fields of a single register, see DS3231M_Field
+ @details  Changes to fields of the same register are combined with "|" at compile time, so that
+           updating several fields is a single read-modify-write of the register
+*/
+struct DS3231M_Update {
+  uint8_t reg;   ///< Register address, 0xFF if fields of different registers were combined
+  uint8_t mask;  ///< Bits being changed
+  uint8_t bits;  ///< New value of the bits being changed
+  /*! @brief   Combine with a change to another field of the same register
+      @param[in] other Change to combine with, takes precedence for overlapping bits
+      @return  Combined change */
+  constexpr DS3231M_Update operator|(const DS3231M_Update& other) const {
+    return DS3231M_Update{reg == other.reg ? reg : (uint8_t)0xFF, (uint8_t)(mask | other.mask),
+                          (uint8_t)((bits & ~other.mask) | other.bits)};
+  }
+  /*! @brief   Apply the change to a register value
+      @param[in] value Register value
+      @return  New register value */
+  constexpr uint8_t apply(const uint8_t value) const { return (value & ~mask) | bits; }
+};  // of struct DS3231M_Update
+
+/*!
+ @brief    Describes a bit field of a DS3231M register
+ @details  Calling a field with a value, e.g. "DS3231M_INTCN(1)", returns the DS3231M_Update that
+           sets it
+*/
+struct DS3231M_Field {
+  uint8_t reg;    ///< Register address
+  uint8_t mask;   ///< Bits of the field
+  uint8_t shift;  ///< Position of the lowest bit of the field
+  /*! @brief   Extract the field from a register value
+      @param[in] value Register value
+      @return  Field value */
+  constexpr uint8_t get(const uint8_t value) const { return (value & mask) >> shift; }
+  /*! @brief   Change that sets the field
+      @param[in] value New field value
+      @return  Change to apply to the register */
+  constexpr DS3231M_Update operator()(const uint8_t value) const {
+    return DS3231M_Update{reg, mask, (uint8_t)((value << shift) & mask)};
+  }
+};  // of struct DS3231M_Field
+
+constexpr DS3231M_Field DS3231M_HOUR_12{DS3231M_RTCHOUR, 0x40, 6};    ///< 12 hour clock mode
+constexpr DS3231M_Field DS3231M_WEEKDAY{DS3231M_RTCWKDAY, 0x07, 0};   ///< Day of the week, 1-7
+constexpr DS3231M_Field DS3231M_A1M1{DS3231M_ALM1SEC, 0x80, 7};       ///< Alarm 1 seconds mask
+constexpr DS3231M_Field DS3231M_A1M2{DS3231M_ALM1MIN, 0x80, 7};       ///< Alarm 1 minutes mask
+constexpr DS3231M_Field DS3231M_A1M3{DS3231M_ALM1HOUR, 0x80, 7};      ///< Alarm 1 hours mask
+constexpr DS3231M_Field DS3231M_A1M4{DS3231M_ALM1DATE, 0x80, 7};      ///< Alarm 1 date mask
+constexpr DS3231M_Field DS3231M_A1DYDT{DS3231M_ALM1DATE, 0x40, 6};    ///< Alarm 1 day, not date
+constexpr DS3231M_Field DS3231M_A2M2{DS3231M_ALM2MIN, 0x80, 7};       ///< Alarm 2 minutes mask
+constexpr DS3231M_Field DS3231M_A2M3{DS3231M_ALM2HOUR, 0x80, 7};      ///< Alarm 2 hours mask
+constexpr DS3231M_Field DS3231M_A2M4{DS3231M_ALM2DATE, 0x80, 7};      ///< Alarm 2 date mask
+constexpr DS3231M_Field DS3231M_A2DYDT{DS3231M_ALM2DATE, 0x40, 6};    ///< Alarm 2 day, not date
+constexpr DS3231M_Field DS3231M_EOSC{DS3231M_CONTROL, 0x80, 7};       ///< Oscillator disabled
+constexpr DS3231M_Field DS3231M_CONV{DS3231M_CONTROL, 0x20, 5};       ///< Temperature conversion
+constexpr DS3231M_Field DS3231M_RS{DS3231M_CONTROL, 0x18, 3};         ///< Square wave rate, DS3231
+constexpr DS3231M_Field DS3231M_RS2{DS3231M_CONTROL, 0x10, 4};        ///< Rate select 2, DS3231
+constexpr DS3231M_Field DS3231M_RS1{DS3231M_CONTROL, 0x08, 3};        ///< Rate select 1, DS3231
+constexpr DS3231M_Field DS3231M_INTCN{DS3231M_CONTROL, 0x04, 2};      ///< INT/SQW pin alarm mode
+constexpr DS3231M_Field DS3231M_A2IE{DS3231M_CONTROL, 0x02, 1};       ///< Alarm 2 interrupt enable
+constexpr DS3231M_Field DS3231M_A1IE{DS3231M_CONTROL, 0x01, 0};       ///< Alarm 1 interrupt enable
+constexpr DS3231M_Field DS3231M_OSF{DS3231M_STATUS, 0x80, 7};         ///< Oscillator stop flag
+constexpr DS3231M_Field DS3231M_EN32KHZ{DS3231M_STATUS, 0x08, 3};     ///< 32kHz output enable
+constexpr DS3231M_Field DS3231M_BSY{DS3231M_STATUS, 0x04, 2};         ///< Conversion busy
+constexpr DS3231M_Field DS3231M_A2F{DS3231M_STATUS, 0x02, 1};         ///< Alarm 2 flag
+constexpr DS3231M_Field DS3231M_A1F{DS3231M_STATUS, 0x01, 0};         ///< Alarm 1 flag
+
 /*!
  @brief    Simple general-purpose date/time class
- @details  Class has no TZ / DST / leap second handling. Copied from RTClib. For further
-           information on this implementation see
- https://github.com/Zanduino/DS3231M/wiki/DateTimeClass
+ @details  Class has no TZ / DST / leap second handling, see DS3231M_TimeZone for conversions
+           between UTC and local time. Copied from RTClib. For further information on this
+           implementation see
+ https://github.com/Zanduino/DS3231M/wiki/DateTimeClass \n\n
+           All constructors except the UNIX time and flash string ones as well as the field and
+           conversion methods are "constexpr", so that constant dates, times and spans are
+           computed by the compiler. The bodies are single return statements for C++11
 */
 class DateTime {
  public:
   DateTime(uint32_t t = 0);
-  DateTime(uint16_t year, uint8_t month, uint8_t day, uint8_t hour = 0, uint8_t min = 0,
-           uint8_t sec = 0);  //                                  //
-  DateTime(const DateTime& copy);
-  DateTime(const char* date, const char* time);
+  /*!
+   @brief     Class Constructor (Overloaded)
+   @details   This implementation ignores time zones and DST changes. It also ignores leapseconds,
+              see http://en.wikipedia.org/wiki/Leap_second for details
+   @param[in] year Year
+   @param[in] month Month
+   @param[in] day Day
+   @param[in] hour Hour
+   @param[in] min Minute
+   @param[in] sec Second
+  */
+  constexpr DateTime(uint16_t year, uint8_t month, uint8_t day, uint8_t hour = 0, uint8_t min = 0,
+                     uint8_t sec = 0)
+      : yOff(year >= 2000 ? year - 2000 : year), m(month), d(day), hh(hour), mm(min), ss(sec) {}
+  /*!
+   @brief     Class Constructor (Overloaded)
+   @param[in] copy DateTime class to instantiate class with
+  */
+  constexpr DateTime(const DateTime& copy)
+      : yOff(copy.yOff), m(copy.m), d(copy.d), hh(copy.hh), mm(copy.mm), ss(copy.ss) {}
+  DateTime& operator=(const DateTime& copy) = default;  ///< Copy assignment
+  /*!
+   @brief     Class Constructor (Overloaded)
+   @details   This version uses a string representation of the date and time to instantiate. The
+              date and time arrive in string format as follows: date = "Dec 26 2009", time =
+              "12:34:56", which is the format of the __DATE__ and __TIME__ macros
+   @param[in] date Character buffer with year value in MMM DD YYYY format
+   @param[in] time Character buffer with time value in HH:MM:SS format
+  */
+  constexpr DateTime(const char* date, const char* time)
+      : yOff(conv2d(date + 9)),
+        m(month2int(date)),
+        d(conv2d(date + 4)),
+        hh(conv2d(time)),
+        mm(conv2d(time + 3)),
+        ss(conv2d(time + 6)) {}
   DateTime(const __FlashStringHelper* date, const __FlashStringHelper* time);
-  uint16_t year() const { return 2000 + yOff; }  ///< Return the year
-  uint8_t  month() const { return m; }           ///< Return the month
-  uint8_t  day() const { return d; }             ///< Return the day
-  uint8_t  hour() const { return hh; }           ///< Return the hour
-  uint8_t  minute() const { return mm; }         ///< Return the minute
-  uint8_t  second() const { return ss; }         ///< Return the second
-  uint8_t  dayOfTheWeek() const;
-  long     secondstime() const;
-  uint32_t unixtime(void) const;
-  DateTime operator+(const TimeSpan& span);   // addition
-  DateTime operator-(const TimeSpan& span);   // subtraction
-  TimeSpan operator-(const DateTime& right);  // subtraction
+  constexpr uint16_t year() const { return 2000 + yOff; }  ///< Return the year
+  constexpr uint8_t  month() const { return m; }           ///< Return the month
+  constexpr uint8_t  day() const { return d; }             ///< Return the day
+  constexpr uint8_t  hour() const { return hh; }           ///< Return the hour
+  constexpr uint8_t  minute() const { return mm; }         ///< Return the minute
+  constexpr uint8_t  second() const { return ss; }         ///< Return the second
+  /*!
+   @brief   Return the day-of-week
+   @details Monday = 1, Sunday = 7. Jan 1, 2000 is a Saturday, i.e. 6, Issue #22a
+   @return  DOW with Monday-Sunday 1-7
+  */
+  constexpr uint8_t dayOfTheWeek() const { return (date2days(yOff, m, d) + 5) % 7 + 1; }
+  /*!
+   @brief   return the time in seconds since 2000-01-01 00:00:00
+   @return  Seconds since 2000-01-01 00:00:00
+  */
+  constexpr long secondstime() const { return time2long(date2days(yOff, m, d), hh, mm, ss); }
+  /*!
+   @brief   return the UNIX time, which is seconds since 1970-01-01 00:00:00
+   @return  UNIX Time (seconds since 1970-01-01 00:00:00)
+  */
+  constexpr uint32_t unixtime(void) const {
+    return time2long(date2days(yOff, m, d), hh, mm, ss) + SECONDS_FROM_1970_TO_2000;
+  }
+  DateTime    operator+(const TimeSpan& span) const;   // addition
+  DateTime    operator-(const TimeSpan& span) const;   // subtraction
+  TimeSpan    operator-(const DateTime& right) const;  // subtraction
+  DateTime&   operator+=(const TimeSpan& span);        // in-place addition
+  DateTime&   operator-=(const TimeSpan& span);        // in-place subtraction
+  static void convertUnixtime(const uint32_t* unixTimes, const size_t count, uint16_t* years,
+                              uint8_t* months, uint8_t* days, uint8_t* hours, uint8_t* minutes,
+                              uint8_t* seconds);  // Batch UNIX time to fields
+  static void convertFields(const uint16_t* years, const uint8_t* months, const uint8_t* days,
+                            const uint8_t* hours, const uint8_t* minutes, const uint8_t* seconds,
+                            const size_t count, uint32_t* unixTimes);  // Batch fields to UNIX
+  static void daysOfTheWeek(const uint32_t* unixTimes, const size_t count,
+                            uint8_t* weekdays);  // Batch day-of-week
+  uint8_t toString(char* buffer, const uint8_t size,
+                   const dateTimeFormats format = isoFormat) const;  // Format as text
+  static parseResults parse(const char* text, DateTime& result,
+                            const dateTimeFormats format = isoFormat);  // Parse text
+  /*!
+   @brief     returns the number of days before the first of the given month in a non-leap year
+   @details   Computed with shifts instead of a table, month 13 returns the days in the year
+   @param[in] m Month
+   @return    Number of days
+  */
+  static constexpr uint16_t daysBeforeMonth(uint8_t m) {
+    return 30 * (m - 1) + ((m + (m >> 3)) >> 1) - (m > 2 ? 2 : 0);
+  }
+  /*!
+   @brief     returns the number of days in a month
+   @param[in] y Year, either with or without the 2000 offset
+   @param[in] m Month, 1 to 12
+   @return    Number of days, 29 for February of a leap year
+  */
+  static constexpr uint8_t daysInMonth(uint16_t y, uint8_t m) {
+    return daysBeforeMonth(m + 1) - daysBeforeMonth(m) +
+           (m == 2 && (((y % 4 == 0) && (y % 100 != 0)) || (y % 400 == 0)));
+  }
+  /*!
+   @brief     returns the number of days from a given Y M D value
+   @param[in] y Years, either with or without the 2000 offset
+   @param[in] m Months
+   @param[in] d Days
+   @return    Number of days since 2000-01-01 from a given Y/M/D value
+  */
+  static constexpr uint16_t date2days(uint16_t y, uint8_t m, uint8_t d) {
+    return y >= 2000 ? date2days(y - 2000, m, d)
+                     : daysBeforeMonth(m) + d +
+                           (m > 2 && (((y % 4 == 0) && (y % 100 != 0)) || (y % 400 == 0))) +
+                           365U * y + (y + 3) / 4 - 1;
+  }
+  /*!
+   @brief     returns the number of seconds from a given D H M S value
+   @param[in] days Days
+   @param[in] h Hours
+   @param[in] m Minutes
+   @param[in] s Seconds
+   @return    Number of seconds from a given Day/Hour/Minute/Second value
+  */
+  static constexpr long time2long(uint16_t days, uint8_t h, uint8_t m, uint8_t s) {
+    return ((days * 24L + h) * 60 + m) * 60 + s;
+  }
+
  protected:
+  bool step(const int32_t seconds);  // Add seconds by carrying into the fields
+  /*!
+   @brief     converts a 2 character string representation to decimal
+   @param[in] p Input character array with length of 2 bytes, a leading space is read as "0"
+   @return    Integer representation of value in array
+  */
+  static constexpr uint8_t conv2d(const char* p) {
+    return 10 * (('0' <= p[0] && p[0] <= '9') ? p[0] - '0' : 0) + p[1] - '0';
+  }
+  /*!
+   @brief     converts the 3 letter English month abbreviation of __DATE__ to the month number
+   @param[in] p Input character array starting with the month abbreviation
+   @return    Month number 1-12
+  */
+  static constexpr uint8_t month2int(const char* p) {
+    return p[0] == 'J'   ? (p[1] == 'a' ? 1 : (p[2] == 'n' ? 6 : 7))  // Jan Jun Jul
+           : p[0] == 'F' ? 2                                          // Feb
+           : p[0] == 'A' ? (p[2] == 'r' ? 4 : 8)                      // Apr Aug
+           : p[0] == 'M' ? (p[2] == 'r' ? 3 : 5)                      // Mar May
+           : p[0] == 'S' ? 9                                          // Sep
+           : p[0] == 'O' ? 10                                         // Oct
+           : p[0] == 'N' ? 11                                         // Nov
+                         : 12;                                        // Dec
+  }
   uint8_t yOff,  ///< Year Offset
       m,         ///< Months
       d,         ///< Days
@@ -162,58 +466,689 @@ class DateTime {
  @brief    Simple general-purpose TimeSpan
  @details  Timespan class which can represent changes in time with seconds accuracy. Copied from
            RTClib. For further infos see **
- https://github.com/Zanduino/DS3231M/wiki/TimeSpanClass
+ https://github.com/Zanduino/DS3231M/wiki/TimeSpanClass \n\n
+           All methods are "constexpr"
 */
 class TimeSpan {
  public:
-  TimeSpan(int32_t seconds = 0);
-  TimeSpan(int16_t days, int8_t hours, int8_t minutes, int8_t seconds);
-  TimeSpan(const TimeSpan& copy);
-  int16_t  days() const { return _seconds / 86400L; }      ///< Return days in span
-  int8_t   hours() const { return _seconds / 3600 % 24; }  ///< Return hours in span
-  int8_t   minutes() const { return _seconds / 60 % 60; }  ///< Return minutes in span
-  int8_t   seconds() const { return _seconds % 60; }       ///< Return seconds in span
-  int32_t  totalseconds() const { return _seconds; }       ///< Return total span in seconds
-  TimeSpan operator+(const TimeSpan& right);
-  TimeSpan operator-(const TimeSpan& right);
+  /*!
+   @brief     TimeSpan class constructor (Overloaded)
+   @param[in] seconds Number of seconds
+  */
+  constexpr TimeSpan(int32_t seconds = 0) : _seconds(seconds) {}
+  /*!
+   @brief     TimeSpan class constructor (Overloaded)
+   @param[in] days Number of Days
+   @param[in] hours Number of Hours
+   @param[in] minutes Number of Minutes
+   @param[in] seconds Number of Seconds
+  */
+  constexpr TimeSpan(int16_t days, int8_t hours, int8_t minutes, int8_t seconds)
+      : _seconds((int32_t)days * 86400L + (int32_t)hours * 3600 + (int32_t)minutes * 60 +
+                 seconds) {}
+  /*!
+   @brief     TimeSpan class constructor (Overloaded)
+   @param[in] copy TimeSpan to use to instantiate class
+  */
+  constexpr TimeSpan(const TimeSpan& copy) : _seconds(copy._seconds) {}
+  constexpr int16_t days() const { return _seconds / 86400L; }      ///< Return days in span
+  constexpr int8_t  hours() const { return _seconds / 3600 % 24; }  ///< Return hours in span
+  constexpr int8_t  minutes() const { return _seconds / 60 % 60; }  ///< Return minutes in span
+  constexpr int8_t  seconds() const { return _seconds % 60; }       ///< Return seconds in span
+  constexpr int32_t totalseconds() const { return _seconds; }       ///< Return total span seconds
+  /*!
+   @brief     TimeSpan class addition (Overloaded)
+   @param[in] right TimeSpan to use to add to value
+   @return    Sum of two TimeSpans
+  */
+  constexpr TimeSpan operator+(const TimeSpan& right) const {
+    return TimeSpan(_seconds + right._seconds);
+  }
+  /*!
+   @brief     TimeSpan class subtraction (Overloaded)
+   @param[in] right TimeSpan to use to subtract from value
+   @return    Difference value
+  */
+  constexpr TimeSpan operator-(const TimeSpan& right) const {
+    return TimeSpan(_seconds - right._seconds);
+  }
 
  protected:
   int32_t _seconds;  ///< internal seconds variable
 };                   // of class TimeSpan definition
 
+/*!
+ @brief    Date/time packed into 4 bytes
+ @details  Stores the seconds since 2000-01-01 00:00:00, so that comparison, subtraction and
+           adding a TimeSpan are single 32-bit operations. The time fields are only decoded when
+           they are requested, the hour, minute and second need no calendar conversion and the
+           date fields use the same closed form conversion as DateTime(uint32_t). Intended for
+           logging large numbers of timestamps, a DateTime takes 6 bytes
+*/
+class PackedDateTime {
+ public:
+  /*!
+   @brief     Class Constructor (Overloaded)
+   @param[in] t UNIX time, seconds since 1970-01-01 00:00:00
+  */
+  constexpr PackedDateTime(uint32_t t = SECONDS_FROM_1970_TO_2000)
+      : _seconds(t - SECONDS_FROM_1970_TO_2000) {}
+  /*!
+   @brief     Class Constructor (Overloaded)
+   @param[in] dt DateTime to pack
+  */
+  constexpr PackedDateTime(const DateTime& dt) : _seconds(dt.secondstime()) {}
+  /*!
+   @brief     Packs the 7 RTC time registers RTCSEC to RTCYEAR without going through DateTime
+   @param[in] frame BCD register values as read from the RTC
+   @return    Packed date/time
+  */
+  static constexpr PackedDateTime fromRegisters(const uint8_t* frame) {
+    return PackedDateTime(DateTime::time2long(DateTime::date2days(bcd2int(frame[6]),
+                                                                  bcd2int(frame[5] & 0x1F),
+                                                                  bcd2int(frame[4] & 0x3F)),
+                                              bcd2int(frame[2] & 0x3F), bcd2int(frame[1] & 0x7F),
+                                              bcd2int(frame[0] & 0x7F)) +
+                          SECONDS_FROM_1970_TO_2000);
+  }
+  void     toRegisters(uint8_t* frame) const;  // Unpack to the 7 RTC time registers
+  DateTime dateTime() const;                   // Unpack to a DateTime
+  uint16_t year() const;                       // Return the year
+  uint8_t  month() const;                      // Return the month
+  uint8_t  day() const;                        // Return the day
+  constexpr uint8_t hour() const { return _seconds % SECONDS_PER_DAY / 3600; }  ///< Return hour
+  constexpr uint8_t minute() const { return _seconds % 3600 / 60; }  ///< Return the minute
+  constexpr uint8_t second() const { return _seconds % 60; }         ///< Return the second
+  /*!
+   @brief   Return the day-of-week
+   @return  DOW with Monday-Sunday 1-7
+  */
+  constexpr uint8_t dayOfTheWeek() const { return (_seconds / SECONDS_PER_DAY + 5) % 7 + 1; }
+  constexpr uint32_t secondstime() const { return _seconds; }  ///< Seconds since 2000-01-01
+  /*!
+   @brief   return the UNIX time, which is seconds since 1970-01-01 00:00:00
+   @return  UNIX Time
+  */
+  constexpr uint32_t unixtime() const { return _seconds + SECONDS_FROM_1970_TO_2000; }
+  /*!
+   @brief     Overloaded addition function definition
+   @param[in] span TimeSpan to add
+   @return    new PackedDateTime value
+  */
+  constexpr PackedDateTime operator+(const TimeSpan& span) const {
+    return PackedDateTime(unixtime() + span.totalseconds());
+  }
+  /*!
+   @brief     Overloaded subtraction function definition
+   @param[in] span TimeSpan to subtract
+   @return    new PackedDateTime value
+  */
+  constexpr PackedDateTime operator-(const TimeSpan& span) const {
+    return PackedDateTime(unixtime() - span.totalseconds());
+  }
+  /*!
+   @brief     Overloaded subtraction function definition
+   @param[in] right PackedDateTime to subtract
+   @return    TimeSpan between the two
+  */
+  constexpr TimeSpan operator-(const PackedDateTime& right) const {
+    return TimeSpan((int32_t)(_seconds - right._seconds));
+  }
+  /*!
+   @brief     Equal comparison
+   @param[in] right PackedDateTime to compare with
+   @return    true when equal
+  */
+  constexpr bool operator==(const PackedDateTime& right) const {
+    return _seconds == right._seconds;
+  }
+  /*!
+   @brief     Unequal comparison
+   @param[in] right PackedDateTime to compare with
+   @return    true when unequal
+  */
+  constexpr bool operator!=(const PackedDateTime& right) const {
+    return _seconds != right._seconds;
+  }
+  /*!
+   @brief     Less than comparison
+   @param[in] right PackedDateTime to compare with
+   @return    true when earlier
+  */
+  constexpr bool operator<(const PackedDateTime& right) const {
+    return _seconds < right._seconds;
+  }
+  /*!
+   @brief     Greater than comparison
+   @param[in] right PackedDateTime to compare with
+   @return    true when later
+  */
+  constexpr bool operator>(const PackedDateTime& right) const {
+    return _seconds > right._seconds;
+  }
+  /*!
+   @brief     Less than or equal comparison
+   @param[in] right PackedDateTime to compare with
+   @return    true when not later
+  */
+  constexpr bool operator<=(const PackedDateTime& right) const {
+    return _seconds <= right._seconds;
+  }
+  /*!
+   @brief     Greater than or equal comparison
+   @param[in] right PackedDateTime to compare with
+   @return    true when not earlier
+  */
+  constexpr bool operator>=(const PackedDateTime& right) const {
+    return _seconds >= right._seconds;
+  }
+
+ protected:
+  /*!
+   @brief     converts a BCD register value to binary
+   @param[in] bcd BCD value
+   @return    Binary value
+  */
+  static constexpr uint8_t bcd2int(const uint8_t bcd) { return (bcd >> 4) * 10 + (bcd & 0x0F); }
+  uint32_t _seconds;  ///< Seconds since 2000-01-01 00:00:00
+};                    // of class PackedDateTime definition
+
+/*!
+ @brief    I2C statistics of one operation type, see DS3231M_Class::statistics()
+ @details  Only kept when the library is compiled with DS3231M_INSTRUMENTATION set to 1
+*/
+struct DS3231M_Statistics {
+  uint32_t transactions;  ///< Number of transactions
+  uint32_t bytes;         ///< Data bytes moved, excluding the register address
+  uint16_t nacks;         ///< Transactions with the address or data not acknowledged
+  uint16_t timeouts;      ///< Transactions that timed out
+  uint16_t errors;        ///< Transactions with any other error
+  uint16_t shortReads;    ///< Reads that returned fewer bytes than requested
+  uint16_t latencyMin;    ///< Shortest transaction in microseconds
+  uint16_t latencyMax;    ///< Longest transaction in microseconds
+  uint32_t latencyTotal;  ///< Sum of all transaction times in microseconds
+  /*! @brief   Mean transaction time
+      @return  Mean time in microseconds, 0 if there were no transactions */
+  uint16_t latencyMean() const { return transactions ? latencyTotal / transactions : 0; }
+};  // of struct DS3231M_Statistics
+
+/*!
+ @brief    Decoded image of all the DS3231M registers, see DS3231M_Class::snapshot()
+*/
+struct DS3231M_Snapshot {
+  DateTime time;              ///< Current Date/Time
+  uint8_t  weekday;           ///< Weekday register, Monday=1 and Sunday=7
+  uint8_t  alarm1Type;        ///< alarmTypes value of alarm 1, UnknownAlarm for other masks
+  uint8_t  alarm1Second;      ///< Alarm 1 seconds
+  uint8_t  alarm1Minute;      ///< Alarm 1 minutes
+  uint8_t  alarm1Hour;        ///< Alarm 1 hours
+  uint8_t  alarm1Day;         ///< Alarm 1 day of month or weekday, depending on the type
+  uint8_t  alarm2Type;        ///< alarmTypes value of alarm 2, UnknownAlarm for other masks
+  uint8_t  alarm2Minute;      ///< Alarm 2 minutes
+  uint8_t  alarm2Hour;        ///< Alarm 2 hours
+  uint8_t  alarm2Day;         ///< Alarm 2 day of month or weekday, depending on the type
+  uint8_t  control;           ///< CONTROL register
+  uint8_t  status;            ///< STATUS register
+  bool     alarm1Enabled;     ///< A1IE, alarm 1 signals on INT/SQW
+  bool     alarm2Enabled;     ///< A2IE, alarm 2 signals on INT/SQW
+  bool     alarm1Triggered;   ///< A1F, alarm 1 flag
+  bool     alarm2Triggered;   ///< A2F, alarm 2 flag
+  bool     stopped;           ///< OSF, the oscillator has stopped since the flag was cleared
+  bool     kHz32;             ///< EN32kHz, the 32kHz output is on
+  bool     pinAlarm;          ///< INTCN, INT/SQW signals alarms instead of the square wave
+  int8_t   agingOffset;       ///< Aging offset
+  int32_t  temperature;       ///< Temperature in 1/100 degrees Celsius
+};  // of struct DS3231M_Snapshot
+
+/*!
+ @brief    I2C bus interface used by DS3231M_Class
+ @details  Each call is a complete I2C transaction, so the overhead of the virtual call is paid per
+           transaction and not per byte. DS3231M_WireBus adapts any object with the "Wire" methods
+           and a simulated device can implement this interface directly
+*/
+class DS3231M_Bus {
+ public:
+  /*! @brief   Start the bus
+      @param[in] i2cSpeed I2C clock speed */
+  virtual void begin(const uint32_t i2cSpeed) = 0;
+  /*! @brief   Write the register address followed by "len" bytes of data to a device
+      @param[in] address I2C address
+      @param[in] reg Register address
+      @param[in] data Bytes to write, may be nullptr when "len" is 0
+      @param[in] len Number of bytes to write, 0 to just set the register pointer
+      @return  Status of the transaction, 0 on success */
+  virtual uint8_t write(const uint8_t address, const uint8_t reg, const uint8_t* data,
+                        const uint8_t len) = 0;
+  /*! @brief   Read "len" bytes from the current register pointer of a device
+      @param[in] address I2C address
+      @param[out] data Buffer for the bytes read
+      @param[in] len Number of bytes to read
+      @return  Number of bytes read */
+  virtual uint8_t read(const uint8_t address, uint8_t* data, const uint8_t len) = 0;
+};  // of DS3231M_Bus class definition
+
+/*!
+ @brief    DS3231M_Bus adapter for "Wire" compatible I2C classes
+ @details  Works with TwoWire as well as software I2C libraries that have the same methods. Every
+           call to the bus object is static, so there is no virtual dispatch beyond DS3231M_Bus
+*/
+template <class T>
+class DS3231M_WireBus : public DS3231M_Bus {
+ public:
+  /*! @brief   Class constructor
+      @param[in] wire "Wire" compatible I2C object */
+  DS3231M_WireBus(T& wire) : _wire(wire) {}
+  /*! @brief   Start the bus
+      @param[in] i2cSpeed I2C clock speed */
+  void begin(const uint32_t i2cSpeed) {
+    _wire.begin();             // Start I2C as master device
+    _wire.setClock(i2cSpeed);  // Set I2C clock speed
+  }
+  /*! @brief   Write the register address followed by "len" bytes of data to a device
+      @param[in] address I2C address
+      @param[in] reg Register address
+      @param[in] data Bytes to write
+      @param[in] len Number of bytes to write
+      @return  Status of the transaction, 0 on success */
+  uint8_t write(const uint8_t address, const uint8_t reg, const uint8_t* data, const uint8_t len) {
+    _wire.beginTransmission(address);  // Address the I2C device
+    _wire.write(reg);                  // Send the register address
+    for (uint8_t i = 0; i < len; ++i) {
+      _wire.write(data[i]);  // Send each data byte
+    }                        // of for-next each byte
+    return _wire.endTransmission();
+  }
+  /*! @brief   Read "len" bytes from the current register pointer of a device
+      @param[in] address I2C address
+      @param[out] data Buffer for the bytes read
+      @param[in] len Number of bytes to read
+      @return  Number of bytes read */
+  uint8_t read(const uint8_t address, uint8_t* data, const uint8_t len) {
+    _wire.requestFrom(address, len);  // Request "len" bytes of data
+    uint8_t bytesRead = 0;
+    while (_wire.available() && bytesRead < len) {
+      data[bytesRead++] = _wire.read();  // read each byte into the buffer
+    }                                    // of while-loop there is data to read
+    return bytesRead;
+  }
+
+ private:
+  T& _wire;  ///< I2C object
+};           // of DS3231M_WireBus class definition
+
 /*!
  @brief    Main DS3231M class definition for the Real-Time clock
 */
 class DS3231M_Class {
  public:
-  DS3231M_Class();
+  DS3231M_Class();                                              // Use "Wire" at DS3231M_ADDRESS
+  DS3231M_Class(DS3231M_Bus& bus, const uint8_t address = DS3231M_ADDRESS);  // Use another bus
   ~DS3231M_Class();                                             // Class destructor
   bool     begin(const uint32_t i2cSpeed = I2C_STANDARD_MODE);  // Start I2C Communications
   void     adjust();                                            // Set the date and time to compile
   void     adjust(const DateTime& dt);                          // Set the date and time
   DateTime now();                                               // return time
+  DateTime now(uint16_t& milliseconds);                         // return time with milliseconds
+  PackedDateTime nowPacked();                                   // return time packed in 4 bytes
+  bool     readTime(DateTime& dt, const uint8_t retries = DS3231M_READ_RETRIES);  // Checked read
+  bool     snapshot(DS3231M_Snapshot& snap);                    // Read all registers in one burst
   int32_t  temperature();                                       // return clock temp in 100x �C
+  bool     temperature(int32_t& temp);                          // Checked temperature read
   bool     isStopped();                                         // Return true if Oscillator stopped
   void     setAlarm(const uint8_t alarmType, const DateTime dt,
                     const bool state = true);         // Set an Alarm
   bool     isAlarm();                                 // Return if alarm is triggered
   void     clearAlarm();                              // Clear the alarm state flag
+  void     clearAlarm(const uint8_t alarms);          // Clear the flags of some alarms only
+  uint8_t  serviceAlarms();                           // Return and clear the triggered alarms
   void     kHz32(const bool state);                   // Turn 32kHz output on or off
   int8_t   getAgingOffset();                          // Get the clock's aging offset
+  bool     getAgingOffset(int8_t& agingOffset);       // Checked aging offset read
   int8_t   setAgingOffset(const int8_t agingOffset);  // Set the clock's aging offset
   uint8_t  weekdayRead();                             // Read weekday from RTC
   uint8_t  weekdayWrite(const uint8_t dow);           // Write weekday to RTC
   void     pinAlarm();                                // Make INTSQW go up on alarm
   void     pinSquareWave();                           // Make INTSQW be a 1Hz signal
   void     pinSquareWave(const uint8_t rate);         // Make INTSQW be a specific Hz on DS3231
+  bool     refresh();                                 // Load the register shadow copy
+  void     invalidate();                              // Discard the register shadow copy
+  uint32_t readCount();                               // Number of I2C read transactions
+  uint32_t writeCount();                              // Number of I2C write transactions
+  void     resetCounters();                           // Reset the I2C transaction counters
+  void     timeBase(const uint32_t interval);         // Serve now() from a local time base
+  void     timeBaseEdge();                            // Record a 1Hz INT/SQW edge, ISR safe
+  uint32_t timeBaseAge();                             // Milliseconds since the anchor read
+  uint16_t timeBaseError();                           // Maximum time base error in milliseconds
+  bool     timeBaseRead(DateTime& dt, uint16_t& milliseconds);  // Checked time base read
+  bool     requestAsync(const uint8_t requestType,
+                        asyncCallback callback = nullptr);  // Queue a non-blocking request
+  uint8_t  pollAsync();                                     // Advance the non-blocking requests
+  DateTime asyncTime();                                     // Result of the last timeRequest
+  int32_t  asyncTemperature();                              // Result of last temperatureRequest
+  uint8_t  asyncStatus();                                   // Result of the last statusRequest
+  bool     asyncSuccess();                                  // Last request read its result
+  bool     startConversion();                               // Force a temperature conversion
+  bool     readConversion(int32_t& temp);                   // Temperature when conversion done
+  uint32_t lastSet();                                       // UNIX time the clock was last set
+  uint8_t  transmissionStatus();                            // Status of the last I2C transaction
+  bool     statistics(const uint8_t operation, DS3231M_Statistics& snapshot);  // Copy statistics
+  void     resetStatistics();                               // Reset all I2C statistics
+
  private:
+  friend class DS3231M_Group;                                  // Group reads the clocks directly
+  friend class DS3231M_Scheduler;                              // Scheduler keeps the A2F flag
   uint8_t  readByte(const uint8_t addr);                       // Read 1 byte from I2C address
   void     writeByte(const uint8_t addr, const uint8_t data);  // Write 1 byte at I2Caddress
-  uint8_t  bcd2int(const uint8_t bcd);                         // convert BCD digits to integer
-  uint8_t  int2bcd(const uint8_t dec);                         // convert integer to BCD
-  uint8_t  _TransmissionStatus = 0;                            ///< Status of I2C transmission
-  uint32_t _SetUnixTime        = 0;                            ///< UNIXtime for clock last set
-  uint8_t  _ss, _mm, _hh, _d, _m;                              ///< Define date components
-  uint16_t _y;                                                 ///< Define date components
-};                                                             // of DS3231M class definition
+  uint8_t  readBytes(const uint8_t addr, uint8_t* data, const uint8_t len);       // Burst read
+  void     writeBytes(const uint8_t addr, const uint8_t* data, const uint8_t len);  // Burst write
+  uint8_t  readRegister(const uint8_t addr);           // Read register, use shadow copy if valid
+  bool     readRegister(const uint8_t addr, uint8_t& value);  // As above, reports failure
+  void     writeAlarm(const uint8_t alarmType, const DateTime& dt, const bool state,
+                      const uint8_t clear);            // Program an alarm, clear some flags
+  bool     readAlarmState(uint8_t* buffer);            // Read CONTROL and STATUS
+  uint8_t  finishAsync(const bool success);            // Complete the async request in progress
+  uint8_t  triggered(const uint8_t* buffer);           // Alarms enabled and flagged
+  uint8_t  writeValue(const DS3231M_Update& change,
+                      const uint8_t value);            // Value to write back for a change
+  void     update(const DS3231M_Update& change);       // Read-modify-write one register
+  void     update(const DS3231M_Update& first,
+                  const DS3231M_Update& second);       // Read-modify-write 2 registers in a burst
+  DateTime readClock();                                // Read the time registers from the device
+  DateTime decodeClock(const uint8_t* buffer);         // Decode the time registers
+  bool     validClock(const uint8_t* buffer);          // Check the time registers are plausible
+  int32_t  decodeTemperature(const uint8_t* buffer);   // Decode the temperature registers
+  bool     anchorTimeBase();                           // Anchor the time base to the RTC
+  uint8_t  bcd2int(const uint8_t bcd);                 // convert BCD digits to integer
+  uint8_t  int2bcd(const uint8_t dec);                 // convert integer to BCD
+  void     record(const uint8_t addr, const bool write, const uint8_t requested,
+                  const uint8_t moved, const uint32_t startMicros);  // Record I2C statistics
+  DS3231M_Bus* _bus;                                   ///< I2C bus of the device
+  uint8_t  _address;                                   ///< I2C address of the device
+  uint8_t  _TransmissionStatus = 0;                    ///< Status of I2C transmission
+  uint32_t _SetUnixTime        = 0;                    ///< UNIXtime for clock last set
+  uint8_t  _ss, _mm, _hh, _d, _m;                      ///< Define date components
+  uint16_t _y;                                         ///< Define date components
+  uint8_t  _shadow[10];                                ///< Shadow of registers ALM1SEC to AGING
+  bool     _shadowValid = false;                       ///< Set when the shadow matches the device
+  uint32_t _readCount   = 0;                           ///< Number of I2C read transactions
+  uint32_t _writeCount  = 0;                           ///< Number of I2C write transactions
+  uint32_t _timeBaseInterval = 0;                      ///< ms between anchor reads, 0 = inactive
+  bool     _anchorValid      = false;                  ///< Set when the time base anchor is valid
+  uint32_t _anchorUnix       = 0;                      ///< UNIX time of the anchor read
+  uint32_t _anchorMillis     = 0;                      ///< millis() value of the anchor read
+  uint32_t _anchorEdge       = 0;                      ///< Edge count at the anchor read
+  volatile uint32_t _edgeCount  = 0;                   ///< Number of 1Hz edges seen, set in ISR
+  volatile uint32_t _edgeMillis = 0;                   ///< millis() at the last 1Hz edge, in ISR
+  uint8_t           _asyncType[DS3231M_ASYNC_QUEUE];   ///< Queue of async request types
+  asyncCallback     _asyncCallback[DS3231M_ASYNC_QUEUE];  ///< Queue of async callbacks
+  uint8_t           _asyncHead        = 0;             ///< Index of the async request in progress
+  uint8_t           _asyncCount       = 0;             ///< Number of queued async requests
+  bool              _asyncAddressed   = false;         ///< Set when the register address was sent
+  uint32_t          _asyncSequence    = 0;             ///< Transaction count at address sent
+  uint32_t          _asyncTime        = 0;             ///< UNIX time of the last timeRequest
+  int32_t           _asyncTemperature = 0;             ///< Last temperatureRequest result
+  uint8_t           _asyncStatus      = 0;             ///< Last statusRequest STATUS register
+  bool              _asyncSuccess     = false;         ///< Last completed request succeeded
+  #if DS3231M_INSTRUMENTATION
+  DS3231M_Statistics _statistics[busOperationCount] = {};  ///< I2C statistics
+  #endif
+};                                                     // of DS3231M class definition
+
+/*!
+ @brief    Software timer multiplexer using alarm 1 of the DS3231M
+ @details  Any number of events up to DS3231M_SCHEDULER_SIZE are kept in a binary min-heap ordered
+           by their deadline. Alarm 1 is always programmed with the nearest deadline using the
+           "secondsMinutesHoursDateMatch" type and the INT/SQW pin is set to signal alarms. The
+           interrupt routine only calls alarmInterrupt() and service() is then called from the
+           main loop, so the MCU can sleep between events and never polls the RTC. Adding and
+           canceling events are O(log n)
+*/
+class DS3231M_Scheduler {
+ public:
+  DS3231M_Scheduler(DS3231M_Class& rtc);                    // Class constructor
+  void    begin();                                          // Set INT/SQW to alarm mode
+  schedulerHandle add(const DateTime& deadline, schedulerCallback callback);  // Schedule an event
+  bool            cancel(const schedulerHandle handle);  // Cancel a scheduled event
+  void            alarmInterrupt();                      // Record the alarm, ISR safe
+  schedulerHandle service();                             // Dispatch expired events
+  schedulerHandle pending();                             // Number of scheduled events
+
+ private:
+  void              siftUp(schedulerHandle position);    // Move a heap entry towards the root
+  void              siftDown(schedulerHandle position);  // Move a heap entry towards the leaves
+  void              swap(schedulerHandle a, schedulerHandle b);  // Swap two heap entries
+  void              removeAt(schedulerHandle position);  // Remove a heap entry
+  void              arm();                               // Program alarm 1 for the next event
+  DS3231M_Class*    _rtc;                                ///< RTC used for the alarm
+  uint32_t          _deadline[DS3231M_SCHEDULER_SIZE];   ///< UNIX time deadline of each handle
+  schedulerCallback _callback[DS3231M_SCHEDULER_SIZE];   ///< Callback of each handle
+  schedulerHandle   _heap[DS3231M_SCHEDULER_SIZE];       ///< Min-heap of handles
+  schedulerHandle   _position[DS3231M_SCHEDULER_SIZE];   ///< Heap position of each handle
+  schedulerHandle   _count = 0;                          ///< Number of scheduled events
+  uint32_t          _armed = 0;                          ///< Deadline programmed into alarm 1
+  volatile bool     _fired = false;                      ///< Set by alarmInterrupt()
+};                                                       // of DS3231M_Scheduler class definition
+
+/*!
+ @brief    Fixed-size ring buffer of timestamped temperature samples
+ @details  Holds the last DS3231M_TEMP_LOG_SIZE samples and keeps the sum, minimum and
+           maximum up-to-date as samples are added, so the statistics never require a pass over the
+           whole log
+*/
+class DS3231M_TemperatureLog {
+ public:
+  DS3231M_TemperatureLog();                                           // Class constructor
+  void    add(const uint32_t unixTime, const int32_t temp);           // Add a sample
+  uint8_t count();                                                    // Number of samples
+  bool    sample(const uint8_t index, uint32_t& unixTime, int32_t& temp);  // Read a sample
+  int32_t minimum();                                                  // Lowest temperature
+  int32_t maximum();                                                  // Highest temperature
+  int32_t mean();                                                     // Mean temperature
+  void    clear();                                                    // Remove all samples
+
+ private:
+  uint32_t _time[DS3231M_TEMP_LOG_SIZE];         ///< UNIX time of each sample
+  int16_t  _temperature[DS3231M_TEMP_LOG_SIZE];  ///< Temperature of each sample
+  uint8_t  _first   = 0;                         ///< Index of the oldest sample
+  uint8_t  _count   = 0;                         ///< Number of samples
+  int32_t  _sum     = 0;                         ///< Sum of all samples
+  int16_t  _minimum = 0;                         ///< Lowest sample
+  int16_t  _maximum = 0;                         ///< Highest sample
+};                                               // of DS3231M_TemperatureLog class definition
+
+/*!
+ @brief    Closed-loop aging offset calibration
+ @details  Reference timestamps from an external time source (GPS, NTP, radio) are compared to the
+           RTC and the drift is estimated with a least-squares fit of the time error against the
+           elapsed reference time. calibrate() converts the drift into aging offset steps of 0.12ppm
+           and records the result against the temperature at which it was measured, so that
+           compensate() can later select the offset matching the current temperature
+*/
+class DS3231M_Calibration {
+ public:
+  DS3231M_Calibration(DS3231M_Class& rtc, calibrationSource source = nullptr);  // Constructor
+  bool    sample();                                        // Take a reference sample
+  void    addSample(const uint32_t refTime, const uint16_t refMillis, const uint32_t rtcTime,
+                    const uint16_t rtcMillis, const int32_t temp);  // Add a sample
+  uint8_t samples();                                       // Number of samples in the fit
+  bool    drift(int32_t& ppm);                             // Fitted drift in 1/100 ppm
+  int8_t  calibrate();                                     // Correct the aging offset
+  bool    compensate();                                    // Apply the offset for the temperature
+  void    reset();                                         // Discard all samples
+
+ private:
+  uint8_t            bin(const int32_t temp);              // Table bin of a temperature
+  DS3231M_Class*     _rtc;                                 ///< Calibrated RTC
+  calibrationSource  _source;                              ///< Reference time source
+  uint32_t           _origin = 0;                          ///< Reference time of first sample
+  uint32_t           _setTime = 0;                         ///< RTC lastSet() of the samples
+  uint32_t           _elapsed[DS3231M_CAL_SAMPLES];        ///< Seconds since _origin
+  int32_t            _error[DS3231M_CAL_SAMPLES];          ///< RTC minus reference in ms
+  int16_t            _temperature[DS3231M_CAL_SAMPLES];    ///< Temperature of each sample
+  uint8_t            _next = 0;                            ///< Next slot to write
+  uint8_t            _count = 0;                           ///< Number of samples
+  int8_t             _table[DS3231M_CAL_BINS];             ///< Aging offset for each bin
+  uint8_t            _tableValid = 0;                      ///< Bit set for each filled bin
+};  // of DS3231M_Calibration class definition
+
+/*!
+ @brief    Reads the time of several RTCs in one pass
+ @details  Used on boards with redundant clocks to cross-check them. The register pointers of all
+           the devices are set first and then the time registers are read back-to-back, so that the
+           reads are as close together as possible
+*/
+class DS3231M_Group {
+ public:
+  DS3231M_Group();                        // Class constructor
+  uint8_t  add(DS3231M_Class& rtc);       // Add an RTC to the group
+  uint8_t  devices();                     // Number of RTCs in the group
+  uint8_t  poll();                        // Read the time of all RTCs
+  DateTime time(const uint8_t index);     // Time read by the last poll()
+  uint32_t spread();                      // Seconds between the earliest and latest RTC
+
+ private:
+  DS3231M_Class* _rtc[DS3231M_GROUP_SIZE];   ///< RTCs in the group
+  uint32_t       _time[DS3231M_GROUP_SIZE];  ///< UNIX time read by the last poll()
+  uint8_t        _count = 0;                 ///< Number of RTCs
+  uint8_t        _valid = 0;                 ///< Bit set for each RTC read successfully
+};                                           // of DS3231M_Group class definition
+
+/*!
+ @brief    Compact event record of DS3231M_EventLog, see DS3231M_EventLog::time()
+*/
+struct DS3231M_Event {
+  uint32_t edge;     ///< INT/SQW edge count at the event
+  uint16_t offset;   ///< Time since that edge in units of the event log resolution
+  uint8_t  channel;  ///< Channel number passed to capture()
+};                   // of struct DS3231M_Event
+
+/*!
+ @brief    Timestamps external events with sub-second resolution
+ @details  The INT/SQW square wave is used as the time base. edge() is called from the INT/SQW
+           interrupt and counts the edges, capture() is called from the interrupt of the event
+           input and stores the edge count and the micros() elapsed since the edge. Neither does
+           any I2C traffic. The records are kept in a lock-free single-producer/single-consumer
+           ring buffer which the main loop drains with read(), and time() converts a record back
+           to an absolute DateTime using the anchor taken by begin()/anchor(). The DS3231M only
+           supports the 1Hz square wave, the DS3231 also 1.024, 4.096 and 8.192kHz. edge() and
+           capture() must not interrupt each other, i.e. the interrupts need the same priority
+*/
+class DS3231M_EventLog {
+ public:
+  DS3231M_EventLog(DS3231M_Class& rtc);                  // Class constructor
+  bool     begin(const uint8_t rate = 0);                // Start the square wave and anchor
+  bool     anchor();                                     // Align the edge count to the RTC
+  void     edge();                                       // Count an INT/SQW edge, ISR
+  void     capture(const uint8_t channel = 0);           // Record an event, ISR
+  uint8_t  available();                                  // Number of records waiting
+  bool     read(DS3231M_Event& event);                   // Remove the oldest record
+  uint16_t dropped();                                    // Records lost to a full buffer
+  DateTime time(const DS3231M_Event& event, uint32_t& microseconds);  // Absolute time of record
+
+ private:
+  DS3231M_Class*    _rtc;                                ///< RTC providing the square wave
+  uint16_t          _rate = 1;                           ///< Square wave frequency in Hz
+  uint8_t           _shift = 0;                          ///< Resolution of "offset" as 2^n us
+  uint32_t          _anchorUnix = 0;                     ///< UNIX time starting at _anchorEdge
+  uint32_t          _anchorEdge = 0;                     ///< Edge at the start of a second
+  volatile uint32_t _edgeCount = 0;                      ///< Edges counted by edge()
+  volatile uint32_t _edgeMicros = 0;                     ///< micros() at the last edge
+  volatile uint16_t _dropped = 0;                        ///< Records lost to a full buffer
+  volatile uint8_t  _head = 0;                           ///< Next record to write, set by ISR
+  volatile uint8_t  _tail = 0;                           ///< Next record to read, set by read()
+  volatile uint32_t _edge[DS3231M_EVENT_QUEUE];          ///< Record edge counts
+  volatile uint16_t _offset[DS3231M_EVENT_QUEUE];        ///< Record offsets
+  volatile uint8_t  _channel[DS3231M_EVENT_QUEUE];       ///< Record channels
+};                                                       // of DS3231M_EventLog class definition
+
+/*!
+ @brief    Time zone and daylight saving time rule, kept in PROGMEM
+ @details  The rule is the one of a POSIX "TZ" string such as "CET-1CEST,M3.5.0,M10.5.0/3". The
+           transitions happen on the "week"th "weekday" of the month, week 5 being the last one,
+           at "hour" of the local time in effect before the change. Without daylight saving time
+           "dst" is 0 and the transition fields are ignored. Zones on the southern hemisphere have
+           the start month after the end month
+*/
+struct DS3231M_Zone {
+  int16_t standard;      ///< Standard time offset east of UTC in minutes
+  uint8_t dst;           ///< Daylight saving time offset added to standard time, in minutes
+  uint8_t startMonth;    ///< Month daylight saving time starts, 1-12
+  uint8_t startWeek;     ///< Week of the month daylight saving time starts, 1-4 or 5 for last
+  uint8_t startWeekday;  ///< Weekday daylight saving time starts, Sunday = 0
+  uint8_t startHour;     ///< Local standard time hour daylight saving time starts
+  uint8_t endMonth;      ///< Month daylight saving time ends, 1-12
+  uint8_t endWeek;       ///< Week of the month daylight saving time ends, 1-4 or 5 for last
+  uint8_t endWeekday;    ///< Weekday daylight saving time ends, Sunday = 0
+  uint8_t endHour;       ///< Local daylight saving time hour daylight saving time ends
+};                       // of struct DS3231M_Zone
+extern const DS3231M_Zone DS3231M_ZONE_UTC PROGMEM;          ///< UTC
+extern const DS3231M_Zone DS3231M_ZONE_LONDON PROGMEM;       ///< Europe/London GMT/BST
+extern const DS3231M_Zone DS3231M_ZONE_BERLIN PROGMEM;       ///< Europe/Berlin CET/CEST
+extern const DS3231M_Zone DS3231M_ZONE_NEW_YORK PROGMEM;     ///< America/New_York EST/EDT
+extern const DS3231M_Zone DS3231M_ZONE_CHICAGO PROGMEM;      ///< America/Chicago CST/CDT
+extern const DS3231M_Zone DS3231M_ZONE_DENVER PROGMEM;       ///< America/Denver MST/MDT
+extern const DS3231M_Zone DS3231M_ZONE_LOS_ANGELES PROGMEM;  ///< America/Los_Angeles PST/PDT
+extern const DS3231M_Zone DS3231M_ZONE_SYDNEY PROGMEM;       ///< Australia/Sydney AEST/AEDT
+extern const DS3231M_Zone DS3231M_ZONE_KOLKATA PROGMEM;      ///< Asia/Kolkata IST
+extern const DS3231M_Zone DS3231M_ZONE_TOKYO PROGMEM;        ///< Asia/Tokyo JST
+
+/*!
+ @brief    Converts between UTC and the local time of a DS3231M_Zone
+ @details  The two daylight saving time transitions of a year are computed once, when a time in a
+           different year is first looked up, and kept as UTC seconds. Every other lookup is two
+           comparisons, so no calendar math is needed for the conversions. Local times in the hour
+           that is repeated when daylight saving time ends are taken as standard time
+*/
+class DS3231M_TimeZone {
+ public:
+  DS3231M_TimeZone(const DS3231M_Zone* zone);      // Class constructor, zone in PROGMEM
+  void     zone(const DS3231M_Zone* zone);         // Change the zone, in PROGMEM
+  int16_t  offset(const uint32_t utc);             // Offset east of UTC in minutes
+  bool     isDst(const uint32_t utc);              // Daylight saving time in effect
+  uint32_t toLocal(const uint32_t utc);            // UNIX time to local seconds
+  uint32_t toUtc(const uint32_t local);            // Local seconds to UNIX time
+  DateTime toLocal(const DateTime& utc);           // UTC date/time to local date/time
+  DateTime toUtc(const DateTime& local);           // Local date/time to UTC date/time
+
+ private:
+  void         load(const uint32_t utc);           // Compute the transitions of a year
+  uint32_t     transition(const uint16_t year, const uint8_t month, const uint8_t week,
+                          const uint8_t weekday, const uint8_t hour, const int16_t offset);
+  DS3231M_Zone _zone;                              ///< RAM copy of the zone rule
+  uint32_t     _yearStart = 0;                     ///< UTC start of the cached year
+  uint32_t     _yearEnd = 0;                       ///< UTC start of the following year
+  uint32_t     _dstStart = 0;                      ///< UTC time daylight saving time starts
+  uint32_t     _dstEnd = 0;                        ///< UTC time daylight saving time ends
+};                                                 // of DS3231M_TimeZone class definition
+
+/*!
+ @brief    Publishes the time and temperature to several tasks or cores without locking
+ @details  A single bus-owner task calls refresh(), which is the only code that accesses the I2C bus
+           and the DS3231M_Class object. Any number of reader tasks call now(), temperature() or
+           read() which copy the last published values under a sequence lock: the writer makes the
+           sequence number odd while it changes the values and even again afterwards, and a reader
+           repeats the copy until it sees the same even number before and after it. Readers never
+           block the writer, do no I2C traffic and take no mutex. Between refreshes the readers
+           advance the time with millis() from the refresh() read of the RTC. All shared fields
+           are accessed with the "__atomic" built-ins of GCC and Clang, so the lock is also
+           correct on multi-core MCUs such as the ESP32
+*/
+class DS3231M_SharedTime {
+ public:
+  DS3231M_SharedTime(DS3231M_Class& rtc);          // Class constructor
+  bool     refresh();                              // Read the RTC and publish, bus owner only
+  bool     read(uint32_t& unixTime, uint16_t& milliseconds,
+                int32_t& temperature);             // Consistent copy of the published values
+  DateTime now();                                  // Current Date/Time from the published values
+  int32_t  temperature();                          // Published temperature
+  uint32_t retries();                              // Copies repeated because of a refresh()
+
+ private:
+  DS3231M_Class* _rtc;                             ///< RTC read by refresh()
+  uint32_t       _sequence    = 0;                 ///< Odd while refresh() changes the values
+  uint32_t       _unixTime    = 0;                 ///< Published UNIX time
+  uint32_t       _millis      = 0;                 ///< millis() when the _unixTime second started
+  int32_t        _temperature = 0;                 ///< Published temperature
+  uint32_t       _retries     = 0;                 ///< Reader copies that had to be repeated
+};                                                 // of DS3231M_SharedTime class definition
 #endif